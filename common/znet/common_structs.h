@@ -31,6 +31,7 @@ SOFTWARE.
 #include <glm/glm.hpp>
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 using PlayerID = std::uint32_t;
 
@@ -87,3 +88,81 @@ inline std::ostream& operator<<(std::ostream& os, const PlayerState& player_stat
 
 template <>
 struct fmt::formatter<PlayerState> : ostream_formatter {};
+
+// Bits of PlayerStateDelta::changed_fields, one per PlayerState member.
+enum PlayerStateField : std::uint16_t {
+  kPlayerStatePosition = 1 << 0,
+  kPlayerStateNrot = 1 << 1,
+  kPlayerStateLeftHandItem = 1 << 2,
+  kPlayerStateRightHandItem = 1 << 3,
+  kPlayerStateEquippedArmor = 1 << 4,
+  kPlayerStateAnimation = 1 << 5,
+  kPlayerStateHealthPoints = 1 << 6,
+  kPlayerStateManaPoints = 1 << 7,
+  kPlayerStateWeaponMode = 1 << 8,
+  kPlayerStateActiveSpell = 1 << 9,
+  kPlayerStateHeadDirection = 1 << 10,
+  kPlayerStateMeleeWeapon = 1 << 11,
+  kPlayerStateRangedWeapon = 1 << 12,
+};
+
+// Calls func(field_bit, member_pointer) for every member of PlayerState, in wire order.
+template <typename Func>
+void ForEachPlayerStateField(Func&& func) {
+  func(kPlayerStatePosition, &PlayerState::position);
+  func(kPlayerStateNrot, &PlayerState::nrot);
+  func(kPlayerStateLeftHandItem, &PlayerState::left_hand_item_instance);
+  func(kPlayerStateRightHandItem, &PlayerState::right_hand_item_instance);
+  func(kPlayerStateEquippedArmor, &PlayerState::equipped_armor_instance);
+  func(kPlayerStateAnimation, &PlayerState::animation);
+  func(kPlayerStateHealthPoints, &PlayerState::health_points);
+  func(kPlayerStateManaPoints, &PlayerState::mana_points);
+  func(kPlayerStateWeaponMode, &PlayerState::weapon_mode);
+  func(kPlayerStateActiveSpell, &PlayerState::active_spell_nr);
+  func(kPlayerStateHeadDirection, &PlayerState::head_direction);
+  func(kPlayerStateMeleeWeapon, &PlayerState::melee_weapon_instance);
+  func(kPlayerStateRangedWeapon, &PlayerState::ranged_weapon_instance);
+}
+
+// The fields of a PlayerState that differ from a baseline. Only the members flagged in changed_fields are
+// meaningful (and serialized), the rest of `state` is left default-initialized.
+struct PlayerStateDelta {
+  std::uint16_t changed_fields{0};
+  PlayerState state;
+};
+
+inline PlayerStateDelta MakePlayerStateDelta(const PlayerState& baseline, const PlayerState& current) {
+  PlayerStateDelta delta;
+  ForEachPlayerStateField([&](std::uint16_t field, auto member) {
+    if (!(baseline.*member == current.*member)) {
+      delta.changed_fields |= field;
+      delta.state.*member = current.*member;
+    }
+  });
+  return delta;
+}
+
+// Overwrites the fields of `state` that are flagged in the delta.
+inline void ApplyPlayerStateDelta(const PlayerStateDelta& delta, PlayerState& state) {
+  ForEachPlayerStateField([&](std::uint16_t field, auto member) {
+    if (delta.changed_fields & field) {
+      state.*member = delta.state.*member;
+    }
+  });
+}
+
+template <typename S>
+void serialize(S& s, PlayerStateDelta& delta) {
+  s.value2b(delta.changed_fields);
+  ForEachPlayerStateField([&](std::uint16_t field, auto member) {
+    if (!(delta.changed_fields & field)) {
+      return;
+    }
+    auto& value = delta.state.*member;
+    if constexpr (std::is_arithmetic_v<std::remove_reference_t<decltype(value)>>) {
+      s.template value<sizeof(value)>(value);
+    } else {
+      s.object(value);
+    }
+  });
+}
@@ -0,0 +1,83 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "net_enums.h"
+
+namespace Net {
+
+// A PT_BATCH message is the packet type byte followed by the batched messages, each of them prefixed with
+// its size as a little-endian 16 bit integer. Batched messages are complete messages of their own, starting
+// with their packet type; batches are never nested.
+inline constexpr std::size_t kBatchHeaderSize = 1;
+inline constexpr std::size_t kBatchEntryHeaderSize = 2;
+inline constexpr std::size_t kMaxBatchedMessageSize = UINT16_MAX;
+
+/**
+ * @brief Appends the message to the batch, starting the batch if it is empty
+ * @param batch Bytes of the batch being built
+ * @param message Complete message, at most kMaxBatchedMessageSize bytes
+ */
+inline void AppendToBatch(std::vector<std::uint8_t>& batch, std::span<const std::uint8_t> message) {
+  if (batch.empty()) {
+    batch.push_back(static_cast<std::uint8_t>(PT_BATCH));
+  }
+  batch.push_back(static_cast<std::uint8_t>(message.size() & 0xFF));
+  batch.push_back(static_cast<std::uint8_t>(message.size() >> 8));
+  batch.insert(batch.end(), message.begin(), message.end());
+}
+
+/**
+ * @brief Calls `func(data, size)` for every message of a PT_BATCH message
+ * @return false if the batch is malformed, messages before the malformed part have been visited already
+ */
+template <typename Func>
+bool ForEachBatchedMessage(unsigned char* data, std::uint32_t size, Func&& func) {
+  if (size < kBatchHeaderSize || data[0] != PT_BATCH) {
+    return false;
+  }
+
+  std::size_t offset = kBatchHeaderSize;
+  while (offset < size) {
+    if (size - offset < kBatchEntryHeaderSize) {
+      return false;
+    }
+    const std::uint32_t message_size = static_cast<std::uint32_t>(data[offset]) | (static_cast<std::uint32_t>(data[offset + 1]) << 8);
+    offset += kBatchEntryHeaderSize;
+    if (message_size == 0 || message_size > size - offset || data[offset] == PT_BATCH) {
+      return false;
+    }
+    func(data + offset, message_size);
+    offset += message_size;
+  }
+  return true;
+}
+
+}  // namespace Net
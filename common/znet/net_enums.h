@@ -26,7 +26,8 @@ SOFTWARE.
 #pragma once
 
 namespace Net {
-enum PacketReliability { UNRELIABLE, RELIABLE, RELIABLE_ORDERED };
+// The sequenced reliabilities deliver only the newest message of a stream, older ones arriving late are dropped.
+enum PacketReliability { UNRELIABLE, RELIABLE, RELIABLE_ORDERED, UNRELIABLE_SEQUENCED, RELIABLE_SEQUENCED };
 
 enum PacketPriority {
   IMMEDIATE_PRIORITY,
@@ -74,6 +75,9 @@ enum PacketID {
   PT_CASTSPELLONTARGET,
   PT_VOICE,
   PT_DISCORD_ACTIVITY,
+  PT_PLAYER_SNAPSHOT,  // Aggregated states/positions of many players, sent once per tick to each player.
+  PT_BATCH,            // Several small messages sent together, see message_batch.h.
+  PT_RESUME_SESSION,   // Takes over a player whose connection was lost, with the token from the initial info.
 };
 
 inline const char* PacketIDToString(PacketID id) {
@@ -152,6 +156,12 @@ inline const char* PacketIDToString(PacketID id) {
       return "PT_VOICE";
     case PT_DISCORD_ACTIVITY:
       return "PT_DISCORD_ACTIVITY";
+    case PT_PLAYER_SNAPSHOT:
+      return "PT_PLAYER_SNAPSHOT";
+    case PT_BATCH:
+      return "PT_BATCH";
+    case PT_RESUME_SESSION:
+      return "PT_RESUME_SESSION";
   }
   return "UNKNOWN";
 }
@@ -0,0 +1,103 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Net {
+
+// Streams are the ordering channels of a connection. Ordered and sequenced messages only wait for, or are
+// dropped in favour of, messages of their own stream, so a lost chat message never holds back a death.
+// Plain reliable and unreliable messages are not ordered and ignore the stream apart from the counters.
+enum Stream : std::uint8_t {
+  STREAM_DEFAULT = 0,
+  STREAM_MOVEMENT = 1,  // Player states (sequenced) and snapshots (unreliable, stale entries dropped per player).
+  STREAM_VOICE = 5,
+  STREAM_SESSION = 9,  // Initial info, resumes and who is in the game: join snapshots, joins, spawns and leaves.
+  STREAM_CHAT = 11,    // Chat, whispers, commands and server messages.
+  STREAM_COMBAT = 13,  // Spells, hits, deaths and respawns.
+};
+
+// RakNet supports 32 ordering channels, sending on a higher one falls back to STREAM_DEFAULT.
+inline constexpr std::uint32_t kStreamCount = 32;
+
+inline const char* StreamToString(std::uint32_t stream) {
+  switch (stream) {
+    case STREAM_DEFAULT:
+      return "default";
+    case STREAM_MOVEMENT:
+      return "movement";
+    case STREAM_VOICE:
+      return "voice";
+    case STREAM_SESSION:
+      return "session";
+    case STREAM_CHAT:
+      return "chat";
+    case STREAM_COMBAT:
+      return "combat";
+  }
+  return "unnamed";
+}
+
+struct StreamStats {
+  std::uint64_t messages{0};
+  std::uint64_t bytes{0};
+};
+
+/**
+ * @brief Counts the messages and bytes sent on every stream of a peer.
+ *
+ * Not thread-safe, the counters are meant to be updated by the thread that sends.
+ */
+class StreamCounters {
+public:
+  /**
+   * @brief Maps a channel passed by a caller onto the stream it is sent on
+   */
+  static std::uint32_t Resolve(std::uint32_t channel) {
+    return channel < kStreamCount ? channel : STREAM_DEFAULT;
+  }
+
+  /**
+   * @brief Records a sent message
+   * @param channel Channel the message was sent on, resolved with Resolve()
+   * @param size Size of the message in bytes
+   */
+  void Record(std::uint32_t channel, std::uint32_t size) {
+    auto& stats = stats_[Resolve(channel)];
+    ++stats.messages;
+    stats.bytes += size;
+  }
+
+  StreamStats Get(std::uint32_t channel) const {
+    return stats_[Resolve(channel)];
+  }
+
+private:
+  std::array<StreamStats, kStreamCount> stats_{};
+};
+
+}  // namespace Net
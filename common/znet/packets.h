@@ -36,8 +36,10 @@ SOFTWARE.
 #include <glm/glm.hpp>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "common_structs.h"
+#include "wire_profile.h"
 
 namespace glm {
 template <typename S>
@@ -318,10 +320,15 @@ struct PlayerStateUpdatePacket {
   std::optional<std::uint32_t> player_id;
 };
 
+template <>
+struct PacketWireProfile<PlayerStateUpdatePacket> {
+  static constexpr WireProfile value = WireProfile::kCompact;
+};
+
 template <typename S>
 void serialize(S& s, PlayerStateUpdatePacket& packet) {
   s.value1b(packet.packet_type);
-  s.object(packet.state);
+  wire::SerializePlayerState<kPacketWireProfile<PlayerStateUpdatePacket>>(s, packet.state);
   s.ext4b(packet.player_id, bitsery::ext::StdOptional{});
 }
 
@@ -345,10 +352,15 @@ struct PlayerPositionUpdatePacket {
   std::optional<std::uint32_t> player_id;
 };
 
+template <>
+struct PacketWireProfile<PlayerPositionUpdatePacket> {
+  static constexpr WireProfile value = WireProfile::kCompact;
+};
+
 template <typename S>
 void serialize(S& s, PlayerPositionUpdatePacket& packet) {
   s.value1b(packet.packet_type);
-  s.object(packet.position);
+  wire::SerializePosition<kPacketWireProfile<PlayerPositionUpdatePacket>>(s, packet.position);
   s.ext4b(packet.player_id, bitsery::ext::StdOptional{});
 }
 
@@ -363,6 +375,175 @@ inline std::ostream& operator<<(std::ostream& os, const PlayerPositionUpdatePack
   return os;
 }
 
+enum class SnapshotEntryKind : std::uint8_t {
+  // Full state, becomes the baseline `baseline_sequence` for the following deltas of the player.
+  kFullState = 0,
+  kPositionOnly = 1,
+  // Fields that differ from the baseline `baseline_sequence`. Dropped by the client if it does not hold that baseline.
+  kDelta = 2,
+};
+
+struct PlayerSnapshotPacket;
+
+// Also applies to the entries, which the server encodes separately from the packet header.
+template <>
+struct PacketWireProfile<PlayerSnapshotPacket> {
+  static constexpr WireProfile value = WireProfile::kCompact;
+};
+
+// One player inside a PlayerSnapshotPacket. Which of the payload members is present depends on the kind.
+struct PlayerSnapshotEntry {
+  std::uint32_t player_id{0};
+  SnapshotEntryKind kind{SnapshotEntryKind::kFullState};
+  // Server replication tick the state in the entry is from, the keyframe's own tick for a full state.
+  // Snapshots are unordered, the client ignores state older than what it applied for the player.
+  std::uint32_t tick{0};
+  std::uint8_t baseline_sequence{0};
+  PlayerState state;
+  PlayerStateDelta delta;
+  glm::vec3 position{0.0f};
+};
+
+template <typename S>
+void serialize(S& s, PlayerSnapshotEntry& entry) {
+  s.value4b(entry.player_id);
+  s.value1b(entry.kind);
+  s.value4b(entry.tick);
+  switch (entry.kind) {
+    case SnapshotEntryKind::kFullState:
+      s.value1b(entry.baseline_sequence);
+      wire::SerializePlayerState<kPacketWireProfile<PlayerSnapshotPacket>>(s, entry.state);
+      break;
+    case SnapshotEntryKind::kDelta:
+      s.value1b(entry.baseline_sequence);
+      wire::SerializePlayerStateDelta<kPacketWireProfile<PlayerSnapshotPacket>>(s, entry.delta);
+      break;
+    default:
+      wire::SerializePosition<kPacketWireProfile<PlayerSnapshotPacket>>(s, entry.position);
+      break;
+  }
+}
+
+inline std::ostream& operator<<(std::ostream& os, const PlayerSnapshotEntry& entry) {
+  os << "PlayerSnapshotEntry { player_id: " << entry.player_id << ", tick: " << entry.tick << ",";
+  switch (entry.kind) {
+    case SnapshotEntryKind::kFullState:
+      os << " baseline_sequence: " << static_cast<int>(entry.baseline_sequence) << ", state: " << entry.state << " }";
+      break;
+    case SnapshotEntryKind::kDelta:
+      os << " baseline_sequence: " << static_cast<int>(entry.baseline_sequence) << ", changed_fields: " << entry.delta.changed_fields << " }";
+      break;
+    default:
+      os << " position: (" << entry.position.x << ", " << entry.position.y << ", " << entry.position.z << ") }";
+      break;
+  }
+  return os;
+}
+
+// Replaces the individual PT_ACTUAL_STATISTICS / PT_MAP_ONLY packets the server relays to each player.
+// The entry count is a fixed 2 byte value so the server can patch it after appending pre-encoded entries.
+struct PlayerSnapshotPacket {
+  std::uint8_t packet_type{0};
+  std::vector<PlayerSnapshotEntry> entries;
+};
+
+template <typename S>
+void serialize(S& s, PlayerSnapshotPacket& packet) {
+  s.value1b(packet.packet_type);
+  auto entry_count = static_cast<std::uint16_t>(packet.entries.size());
+  s.value2b(entry_count);
+  packet.entries.resize(entry_count);
+  for (auto& entry : packet.entries) {
+    s.object(entry);
+  }
+}
+
+inline std::ostream& operator<<(std::ostream& os, const PlayerSnapshotPacket& packet) {
+  os << "PlayerSnapshotPacket {"
+     << " packet_type: " << static_cast<int>(packet.packet_type) << ", entries: " << packet.entries.size() << " }";
+  return os;
+}
+
+template <>
+struct fmt::formatter<PlayerSnapshotPacket> : ostream_formatter {};
+
+// Whether a snapshot entry taken on `tick` is newer than one taken on `last_tick`, across the wrap around.
+inline bool IsNewerSnapshotTick(std::uint32_t tick, std::uint32_t last_tick) {
+  return static_cast<std::int32_t>(tick - last_tick) > 0;
+}
+
+/**
+ * @brief Client side view of one remote player, built from the snapshot entries received for it.
+ *
+ * The server may put a player's keyframe and a delta against it into the same snapshot, the keyframe
+ * carrying the older tick it was taken on. A full state therefore always becomes the baseline if it is
+ * newer than the current baseline, but is only applied if it is newer than the state applied last.
+ */
+class RemoteSnapshotState {
+public:
+  enum class Result : std::uint8_t {
+    // The entry is the newest state of the player: GetState() for a full state or delta, the entry's
+    // position for a position-only entry.
+    kApply,
+    // Older than what was applied already, a full state may still have become the new baseline.
+    kStale,
+    // A delta against a baseline that was lost or overtaken, the server sends a new one shortly.
+    kMissingBaseline,
+  };
+
+  Result Accept(const PlayerSnapshotEntry& entry) {
+    switch (entry.kind) {
+      case SnapshotEntryKind::kFullState:
+        if (!has_baseline_ || IsNewerSnapshotTick(entry.tick, baseline_tick_)) {
+          has_baseline_ = true;
+          baseline_sequence_ = entry.baseline_sequence;
+          baseline_tick_ = entry.tick;
+          baseline_ = entry.state;
+        }
+        if (!IsNewer(entry.tick)) {
+          return Result::kStale;
+        }
+        state_ = entry.state;
+        break;
+      case SnapshotEntryKind::kDelta:
+        if (!has_baseline_ || baseline_sequence_ != entry.baseline_sequence) {
+          return Result::kMissingBaseline;
+        }
+        if (!IsNewer(entry.tick)) {
+          return Result::kStale;
+        }
+        state_ = baseline_;
+        ApplyPlayerStateDelta(entry.delta, state_);
+        break;
+      case SnapshotEntryKind::kPositionOnly:
+        if (!IsNewer(entry.tick)) {
+          return Result::kStale;
+        }
+        break;
+    }
+    has_applied_ = true;
+    applied_tick_ = entry.tick;
+    return Result::kApply;
+  }
+
+  const PlayerState& GetState() const {
+    return state_;
+  }
+
+private:
+  bool IsNewer(std::uint32_t tick) const {
+    return !has_applied_ || IsNewerSnapshotTick(tick, applied_tick_);
+  }
+
+  bool has_baseline_{false};
+  std::uint8_t baseline_sequence_{0};
+  std::uint32_t baseline_tick_{0};
+  PlayerState baseline_;
+  bool has_applied_{false};
+  std::uint32_t applied_tick_{0};
+  PlayerState state_;
+};
+
 struct HPDiffPacket {
   std::uint8_t packet_type;
   std::uint32_t player_id;
@@ -413,6 +594,32 @@ inline std::ostream& operator<<(std::ostream& os, const DisconnectionInfoPacket&
   return os;
 }
 
+// Sent by a reconnecting client with the resume token of its previous connection. The server
+// answers with the same packet: the resumed player's ID and its next token, or no ID if the
+// session could not be resumed and the client has to join from scratch.
+struct ResumeSessionPacket {
+  std::uint8_t packet_type;
+  std::string resume_token;
+  std::optional<std::uint32_t> player_id;
+};
+
+template <typename S>
+void serialize(S& s, ResumeSessionPacket& packet) {
+  s.value1b(packet.packet_type);
+  s.text1b(packet.resume_token, 64);
+  s.ext4b(packet.player_id, bitsery::ext::StdOptional{});
+}
+
+inline std::ostream& operator<<(std::ostream& os, const ResumeSessionPacket& packet) {
+  os << "ResumeSessionPacket {"
+     << " packet_type: " << static_cast<int>(packet.packet_type);
+  if (packet.player_id) {
+    os << ", player_id: " << *packet.player_id;
+  }
+  os << " }";
+  return os;
+}
+
 struct PlayerDeathInfoPacket {
   std::uint8_t packet_type;
   std::uint32_t player_id;
@@ -480,20 +687,40 @@ struct InitialInfoPacket {
   std::string map_name;
   std::uint32_t player_id;
   std::string resource_token;
+  // Lets the client take its player over again after losing the connection, empty if the server does not allow it
+  std::string resume_token;
   std::string resource_base_path;
   std::vector<ClientResourceInfoEntry> client_resources;
 };
 
+// InitialInfoPacket is serialized in three parts, the head and tail are the same for every connection
+// and may be encoded once, the server only encodes the connection's own fields per connection.
 template <typename S>
-void serialize(S& s, InitialInfoPacket& packet) {
+void SerializeInitialInfoHead(S& s, InitialInfoPacket& packet) {
   s.value1b(packet.packet_type);
   s.text1b(packet.map_name, 64);
+}
+
+template <typename S>
+void SerializeInitialInfoConnectionFields(S& s, InitialInfoPacket& packet) {
   s.value4b(packet.player_id);
   s.text1b(packet.resource_token, 64);
+  s.text1b(packet.resume_token, 64);
+}
+
+template <typename S>
+void SerializeInitialInfoTail(S& s, InitialInfoPacket& packet) {
   s.text1b(packet.resource_base_path, 64);
   s.container(packet.client_resources, 128);
 }
 
+template <typename S>
+void serialize(S& s, InitialInfoPacket& packet) {
+  SerializeInitialInfoHead(s, packet);
+  SerializeInitialInfoConnectionFields(s, packet);
+  SerializeInitialInfoTail(s, packet);
+}
+
 inline std::ostream& operator<<(std::ostream& os, const InitialInfoPacket& packet) {
   os << "InitialInfoPacket {"
      << " packet_type: " << static_cast<int>(packet.packet_type) << ", map_name: " << packet.map_name << ", player_id: " << packet.player_id
@@ -0,0 +1,192 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <bitsery/bitsery.h>
+#include <bitsery/ext/value_range.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <type_traits>
+
+#include "common_structs.h"
+
+// Wire encodings a packet type can be serialized with.
+enum class WireProfile {
+  // Plain 4 byte floats and full width integers.
+  kRaw,
+  // Bit packed: fixed-point world positions, octahedral unit vectors and narrow small integers.
+  // Values outside of the supported ranges are clamped.
+  kCompact,
+};
+
+// Selects the wire profile of a packet type, specialize it next to the packet to opt into kCompact.
+// Both peers must agree on the profile, so changing it is a protocol change.
+template <typename Packet>
+struct PacketWireProfile {
+  static constexpr WireProfile value = WireProfile::kRaw;
+};
+
+template <typename Packet>
+inline constexpr WireProfile kPacketWireProfile = PacketWireProfile<Packet>::value;
+
+namespace wire {
+
+// Gothic worlds fit well within +-1310 meters of the origin (1 unit = 1 cm).
+inline constexpr float kWorldExtent = 131072.0f;
+inline constexpr float kPositionPrecision = 1.0f;
+inline constexpr float kOctahedralPrecision = 1.0f / 1024.0f;
+inline constexpr std::uint8_t kMaxWeaponMode = 7;
+inline constexpr std::uint8_t kMaxActiveSpell = 127;
+inline constexpr std::uint8_t kMaxHeadDirection = 4;
+
+template <typename S>
+struct IsDeserializer : std::false_type {};
+
+template <typename Adapter, typename Context>
+struct IsDeserializer<bitsery::Deserializer<Adapter, Context>> : std::true_type {};
+
+// Writes a clamped copy of the value, so the sender's data is never modified.
+template <typename T, typename SBP>
+void SerializeInRange(SBP& sbp, T& value, T min, T max, T precision_or_zero = T{}) {
+  bitsery::ext::ValueRange<T> range = [&] {
+    if constexpr (std::is_floating_point_v<T>) {
+      return bitsery::ext::ValueRange<T>{min, max, precision_or_zero};
+    } else {
+      return bitsery::ext::ValueRange<T>{min, max};
+    }
+  }();
+  if constexpr (IsDeserializer<SBP>::value) {
+    sbp.ext(value, range);
+  } else {
+    T clamped = std::clamp(value, min, max);
+    sbp.ext(clamped, range);
+  }
+}
+
+// 19 bits per axis at 1 cm precision.
+template <typename SBP>
+void SerializeWorldPosition(SBP& sbp, glm::vec3& position) {
+  SerializeInRange(sbp, position.x, -kWorldExtent, kWorldExtent, kPositionPrecision);
+  SerializeInRange(sbp, position.y, -kWorldExtent, kWorldExtent, kPositionPrecision);
+  SerializeInRange(sbp, position.z, -kWorldExtent, kWorldExtent, kPositionPrecision);
+}
+
+inline float SignNotZero(float value) {
+  return value < 0.0f ? -1.0f : 1.0f;
+}
+
+// Octahedral encoding: the unit sphere is projected onto an octahedron and unfolded into [-1, 1]^2,
+// 2 x 12 bits instead of 3 x 32. A zero vector is sent as (0, 0, 1).
+template <typename SBP>
+void SerializeUnitVector(SBP& sbp, glm::vec3& vec) {
+  float u = 0.0f;
+  float v = 0.0f;
+
+  if constexpr (!IsDeserializer<SBP>::value) {
+    const float l1_norm = std::abs(vec.x) + std::abs(vec.y) + std::abs(vec.z);
+    if (l1_norm > 0.0f) {
+      u = vec.x / l1_norm;
+      v = vec.y / l1_norm;
+      if (vec.z < 0.0f) {
+        const float folded_u = (1.0f - std::abs(v)) * SignNotZero(u);
+        const float folded_v = (1.0f - std::abs(u)) * SignNotZero(v);
+        u = folded_u;
+        v = folded_v;
+      }
+    }
+  }
+
+  SerializeInRange(sbp, u, -1.0f, 1.0f, kOctahedralPrecision);
+  SerializeInRange(sbp, v, -1.0f, 1.0f, kOctahedralPrecision);
+
+  if constexpr (IsDeserializer<SBP>::value) {
+    glm::vec3 decoded(u, v, 1.0f - std::abs(u) - std::abs(v));
+    if (decoded.z < 0.0f) {
+      decoded.x = (1.0f - std::abs(v)) * SignNotZero(u);
+      decoded.y = (1.0f - std::abs(u)) * SignNotZero(v);
+    }
+    vec = glm::normalize(decoded);
+  }
+}
+
+// Serializes one PlayerState member, using a narrow encoding for the members that have one.
+template <WireProfile Profile, typename S, typename T>
+void SerializePlayerStateField(S& s, std::uint16_t field, T& value) {
+  if constexpr (Profile == WireProfile::kCompact && std::is_same_v<T, glm::vec3>) {
+    if (field == kPlayerStatePosition) {
+      SerializeWorldPosition(s, value);
+    } else {
+      SerializeUnitVector(s, value);
+    }
+  } else if constexpr (Profile == WireProfile::kCompact && std::is_same_v<T, std::uint8_t>) {
+    const std::uint8_t max = field == kPlayerStateWeaponMode ? kMaxWeaponMode : field == kPlayerStateActiveSpell ? kMaxActiveSpell : kMaxHeadDirection;
+    SerializeInRange(s, value, std::uint8_t{0}, max);
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    s.template value<sizeof(T)>(value);
+  } else {
+    s.object(value);
+  }
+}
+
+template <WireProfile Profile, typename S>
+void SerializePlayerState(S& s, PlayerState& state) {
+  if constexpr (Profile == WireProfile::kCompact) {
+    s.enableBitPacking([&](typename S::BPEnabledType& sbp) {
+      ForEachPlayerStateField([&](std::uint16_t field, auto member) { SerializePlayerStateField<Profile>(sbp, field, state.*member); });
+    });
+  } else {
+    s.object(state);
+  }
+}
+
+template <WireProfile Profile, typename S>
+void SerializePlayerStateDelta(S& s, PlayerStateDelta& delta) {
+  if constexpr (Profile == WireProfile::kCompact) {
+    s.value2b(delta.changed_fields);
+    s.enableBitPacking([&](typename S::BPEnabledType& sbp) {
+      ForEachPlayerStateField([&](std::uint16_t field, auto member) {
+        if (delta.changed_fields & field) {
+          SerializePlayerStateField<Profile>(sbp, field, delta.state.*member);
+        }
+      });
+    });
+  } else {
+    s.object(delta);
+  }
+}
+
+template <WireProfile Profile, typename S>
+void SerializePosition(S& s, glm::vec3& position) {
+  if constexpr (Profile == WireProfile::kCompact) {
+    s.enableBitPacking([&](typename S::BPEnabledType& sbp) { SerializeWorldPosition(sbp, position); });
+  } else {
+    s.object(position);
+  }
+}
+
+}  // namespace wire
@@ -58,6 +58,8 @@ public:
   // Player events
   virtual void OnLocalPlayerJoined(gmp::client::Player& player) {}
   virtual void OnLocalPlayerSpawned(gmp::client::Player& player) {}
+  // The player was taken over again after a lost connection, the world and other players were kept.
+  virtual void OnSessionResumed(gmp::client::Player& player) {}
   virtual void OnPlayerJoined(gmp::client::Player& player) {}
   virtual void OnPlayerSpawned(gmp::client::Player& player) {}
   virtual void OnPlayerLeft(std::uint64_t player_id, const std::string& player_name) {}
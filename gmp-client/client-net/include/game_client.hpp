@@ -30,10 +30,12 @@ SOFTWARE.
 #include <functional>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "common_structs.h"
@@ -57,6 +59,9 @@ public:
   ~GameClient();
 
   void ConnectAsync(std::string_view endpoint);
+  // Connects to the last server again. If the connection was lost and the server still keeps
+  // the player, it is taken over again instead of joining from scratch (see OnSessionResumed).
+  void Reconnect();
   void Disconnect();
   bool IsConnected() const;
   ConnectionState GetConnectionState() const;
@@ -111,10 +116,18 @@ private:
   // Helper to update player state from PlayerState struct
   void UpdatePlayerState(Player* player, const PlayerState& state);
 
+  // Shared by the single player update packets and PT_PLAYER_SNAPSHOT
+  void ApplyRemotePlayerState(std::uint32_t player_id, const PlayerState& state);
+  void ApplyRemotePlayerPosition(std::uint32_t player_id, const glm::vec3& position);
+
   // Packet handlers
   void OnInitialInfo(Packet packet);
+  void OnResumeSession(Packet packet);
+  void ApplyInitialInfo(InitialInfoPacket& packet);
   void OnActualStatistics(Packet packet);
   void OnMapOnly(Packet packet);
+  void OnBatch(Packet packet);
+  void OnPlayerSnapshot(Packet packet);
   void OnDoDie(Packet packet);
   void OnRespawn(Packet packet);
   void OnCastSpell(Packet packet);
@@ -141,11 +154,19 @@ private:
   std::map<int, PacketHandlerFunc> packet_handlers_;
   std::vector<World> worlds_;
 
+  // Baseline and newest applied state of each remote player, built from the PT_PLAYER_SNAPSHOT entries.
+  std::unordered_map<std::uint32_t, RemoteSnapshotState> snapshot_states_;
+
   std::string server_ip_;
   std::uint32_t server_port_{0};
   bool connection_lost_{false};
   bool is_in_game_{false};
 
+  // Token to take the player over with after losing the connection, empty if there is nothing to resume.
+  std::string resume_token_;
+  // Initial info of the new connection, held back until the server answers the resume request.
+  std::optional<InitialInfoPacket> pending_initial_info_;
+
   ResourceDownloader resource_downloader_;
 
   // Async connection support
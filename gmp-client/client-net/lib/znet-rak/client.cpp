@@ -62,6 +62,10 @@ namespace {
       return ::RELIABLE_ORDERED;
     case UNRELIABLE:
       return ::UNRELIABLE;
+    case UNRELIABLE_SEQUENCED:
+      return ::UNRELIABLE_SEQUENCED;
+    case RELIABLE_SEQUENCED:
+      return ::RELIABLE_SEQUENCED;
   }
   return ::RELIABLE;
 }
@@ -110,14 +114,20 @@ bool RakNetClient::IsConnected() const {
   return isConnected_;
 }
 
-bool RakNetClient::SendPacket(unsigned char* data, std::uint32_t size, PacketReliability packetReliability,
-                              PacketPriority packetPriority) {
+bool RakNetClient::SendPacket(unsigned char* data, std::uint32_t size, PacketReliability packetReliability, PacketPriority packetPriority,
+                              std::uint32_t channel) {
   // TODO: VALIDATION AND ENCRYPTION.
+  const std::uint32_t stream = StreamCounters::Resolve(channel);
   peer_->Send(reinterpret_cast<const char*>(data), size, ToRakNetPacketPriority(packetPriority),
-              ToRakNetPacketReliability(packetReliability), 0, serverAddress_, false);
+              ToRakNetPacketReliability(packetReliability), static_cast<char>(stream), serverAddress_, false);
+  stream_counters_.Record(stream, size);
   return true;
 }
 
+StreamStats RakNetClient::GetStreamStats(std::uint32_t stream) const {
+  return stream_counters_.Get(stream);
+}
+
 void RakNetClient::Pulse() {
   for (RakNet::Packet* packet = peer_->Receive(); packet; peer_->DeallocatePacket(packet), packet = peer_->Receive()) {
     std::for_each(packetHandlers_.begin(), packetHandlers_.end(),
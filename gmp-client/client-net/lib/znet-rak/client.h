@@ -41,8 +41,9 @@ public:
   bool Connect(const char* address, std::uint32_t port) override;
   void Disconnect() override;
   bool IsConnected() const override;
-  bool SendPacket(unsigned char* data, std::uint32_t size, PacketReliability packetReliability,
-                  PacketPriority packetPriority) override;
+  bool SendPacket(unsigned char* data, std::uint32_t size, PacketReliability packetReliability, PacketPriority packetPriority,
+                  std::uint32_t channel) override;
+  StreamStats GetStreamStats(std::uint32_t stream) const override;
 
   void AddPacketHandler(PacketHandler& packetHandler) override;
   void RemovePacketHandler(PacketHandler& packetHandler) override;
@@ -53,6 +54,7 @@ private:
   RakNet::SystemAddress serverAddress_;
   std::unordered_set<PacketHandler*> packetHandlers_;
   bool isConnected_{false};
+  StreamCounters stream_counters_;
 };
 
 }  // namespace Net
@@ -29,6 +29,7 @@ SOFTWARE.
 #include <string>
 
 #include "net_enums.h"
+#include "net_streams.h"
 
 namespace Net {
 
@@ -49,7 +50,12 @@ public:
   virtual void Disconnect() = 0;
   virtual bool IsConnected() const = 0;
 
-  virtual bool SendPacket(unsigned char* data, std::uint32_t size, PacketReliability packetReliability, PacketPriority packetPriority) = 0;
+  // `channel` is the stream the packet is ordered or sequenced on, see net_streams.h.
+  virtual bool SendPacket(unsigned char* data, std::uint32_t size, PacketReliability packetReliability, PacketPriority packetPriority,
+                          std::uint32_t channel) = 0;
+
+  // Packets and bytes sent on the stream since the client was created.
+  virtual StreamStats GetStreamStats(std::uint32_t stream) const = 0;
 
   virtual void AddPacketHandler(PacketHandler& packetHandler) = 0;
   virtual void RemovePacketHandler(PacketHandler& packetHandler) = 0;
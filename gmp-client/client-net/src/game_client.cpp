@@ -38,7 +38,9 @@ SOFTWARE.
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
+#include "message_batch.h"
 #include "net_enums.h"
 #include "packets.h"
 #include "shared/crypto_utils.h"
@@ -51,10 +53,11 @@ using namespace Net;
 static Net::NetClient* g_netclient = nullptr;
 
 template <typename TContainer = std::vector<std::uint8_t>, typename Packet>
-static void SerializeAndSend(const Packet& packet, Net::PacketPriority priority, Net::PacketReliability reliable) {
+static void SerializeAndSend(const Packet& packet, Net::PacketPriority priority, Net::PacketReliability reliable,
+                             std::uint32_t channel = STREAM_DEFAULT) {
   TContainer buffer;
   auto written_size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<TContainer>>(buffer, packet);
-  g_netclient->SendPacket(buffer.data(), written_size, reliable, priority);
+  g_netclient->SendPacket(buffer.data(), written_size, reliable, priority, channel);
 }
 
 GameClient::GameClient(EventObserver& eventObserver, gmp::TaskScheduler& taskScheduler)
@@ -85,6 +88,7 @@ void GameClient::InitPacketHandlers() {
   packet_handlers_[PT_INITIAL_INFO] = [this](Packet p) { OnInitialInfo(p); };
   packet_handlers_[PT_ACTUAL_STATISTICS] = [this](Packet p) { OnActualStatistics(p); };
   packet_handlers_[PT_MAP_ONLY] = [this](Packet p) { OnMapOnly(p); };
+  packet_handlers_[PT_PLAYER_SNAPSHOT] = [this](Packet p) { OnPlayerSnapshot(p); };
   packet_handlers_[PT_DODIE] = [this](Packet p) { OnDoDie(p); };
   packet_handlers_[PT_RESPAWN] = [this](Packet p) { OnRespawn(p); };
   packet_handlers_[PT_CASTSPELL] = [this](Packet p) { OnCastSpell(p); };
@@ -101,6 +105,8 @@ void GameClient::InitPacketHandlers() {
   packet_handlers_[PT_GAME_INFO] = [this](Packet p) { OnGameInfo(p); };
   packet_handlers_[PT_LEFT_GAME] = [this](Packet p) { OnLeftGame(p); };
   packet_handlers_[PT_DISCORD_ACTIVITY] = [this](Packet p) { OnDiscordActivity(p); };
+  packet_handlers_[PT_BATCH] = [this](Packet p) { OnBatch(p); };
+  packet_handlers_[PT_RESUME_SESSION] = [this](Packet p) { OnResumeSession(p); };
   packet_handlers_[Net::ID_DISCONNECTION_NOTIFICATION] = [this](Packet p) { OnDisconnectOrLostConnection(p); };
   packet_handlers_[Net::ID_CONNECTION_LOST] = [this](Packet p) { OnDisconnectOrLostConnection(p); };
 }
@@ -122,7 +128,9 @@ void GameClient::ConnectAsync(std::string_view full_address) {
 
     connection_state_ = ConnectionState::Connecting;
     connection_error_.clear();
+    connection_lost_ = false;
   }
+  pending_initial_info_.reset();
 
   resource_downloader_.Reset();
 
@@ -176,8 +184,20 @@ bool GameClient::ConnectInternal(std::string_view full_address) {
   return true;
 }
 
+void GameClient::Reconnect() {
+  if (server_ip_.empty()) {
+    SPDLOG_WARN("Cannot reconnect, no server was connected to before");
+    return;
+  }
+  ConnectAsync(server_ip_ + ":" + std::to_string(server_port_));
+}
+
 void GameClient::Disconnect() {
   bool was_connected = IsConnected();
+  // Leaving on purpose, the server drops the player right away.
+  if (was_connected) {
+    resume_token_.clear();
+  }
 
   // Join connection thread if it's still running
   {
@@ -281,14 +301,14 @@ void GameClient::JoinGame(const std::string& player_name, const std::string& cha
   packet.walk_style = walk_style;
   packet.player_name = player_name;
 
-  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED);
+  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, STREAM_SESSION);
 }
 
 void GameClient::SendChatMessage(const std::string& msg) {
   MessagePacket packet;
   packet.packet_type = PT_MSG;
   packet.message = msg;
-  SerializeAndSend(packet, MEDIUM_PRIORITY, RELIABLE);
+  SerializeAndSend(packet, MEDIUM_PRIORITY, RELIABLE_ORDERED, STREAM_CHAT);
 }
 
 void GameClient::SendWhisper(std::uint64_t recipient_id, const std::string& msg) {
@@ -296,14 +316,14 @@ void GameClient::SendWhisper(std::uint64_t recipient_id, const std::string& msg)
   packet.packet_type = PT_WHISPER;
   packet.message = msg;
   packet.recipient = recipient_id;
-  SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE_ORDERED);
+  SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE_ORDERED, STREAM_CHAT);
 }
 
 void GameClient::SendCommand(const std::string& msg) {
   MessagePacket packet;
   packet.packet_type = PT_COMMAND;
   packet.message = msg;
-  SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE_ORDERED);
+  SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE_ORDERED, STREAM_CHAT);
 }
 
 void GameClient::SendCastSpell(std::uint64_t target_id, std::uint16_t spell_id) {
@@ -313,7 +333,7 @@ void GameClient::SendCastSpell(std::uint64_t target_id, std::uint16_t spell_id)
   if (target_id) {
     packet.target_id = target_id;
   }
-  SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE);
+  SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE, STREAM_COMBAT);
 }
 
 void GameClient::SendDropItem(std::uint16_t instance, std::uint16_t amount) {
@@ -335,7 +355,8 @@ void GameClient::UpdatePlayerStats(const PlayerState& state) {
   PlayerStateUpdatePacket packet;
   packet.packet_type = PT_ACTUAL_STATISTICS;
   packet.state = state;
-  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED);
+  // Sent every few frames, a newer state makes a lost or late one pointless.
+  SerializeAndSend(packet, IMMEDIATE_PRIORITY, UNRELIABLE_SEQUENCED, STREAM_MOVEMENT);
 }
 
 void GameClient::SendHPDiff(std::uint64_t player_id, std::int16_t diff) {
@@ -343,12 +364,12 @@ void GameClient::SendHPDiff(std::uint64_t player_id, std::int16_t diff) {
   packet.packet_type = PT_HP_DIFF;
   packet.player_id = player_id;
   packet.hp_difference = diff;
-  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE);
+  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE, STREAM_COMBAT);
 }
 
 void GameClient::SyncGameTime() {
   std::uint8_t data[2] = {PT_GAME_INFO, 0};
-  g_netclient->SendPacket(data, 1, RELIABLE, IMMEDIATE_PRIORITY);
+  g_netclient->SendPacket(data, 1, RELIABLE, IMMEDIATE_PRIORITY, STREAM_SESSION);
 }
 
 // ============================================================================
@@ -365,15 +386,64 @@ void GameClient::OnInitialInfo(Packet p) {
     return;
   }
 
+  // The server may still keep the player of a lost connection, taking it over is much cheaper than joining again.
+  if (!resume_token_.empty() && player_manager_.HasLocalPlayer()) {
+    ResumeSessionPacket request;
+    request.packet_type = PT_RESUME_SESSION;
+    request.resume_token = std::exchange(resume_token_, std::string());
+    pending_initial_info_ = std::move(packet);
+    SerializeAndSend(request, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, STREAM_SESSION);
+    SPDLOG_INFO("Trying to resume the session of player {}", player_manager_.GetLocalPlayer().id());
+    return;
+  }
+
+  ApplyInitialInfo(packet);
+}
+
+void GameClient::OnResumeSession(Packet p) {
+  ResumeSessionPacket packet;
+  using InputAdapter = bitsery::InputBufferAdapter<unsigned char*>;
+  auto state = bitsery::quickDeserialization<InputAdapter>({p.data, p.length}, packet);
+
+  if (!state.second || !pending_initial_info_.has_value()) {
+    SPDLOG_ERROR("Unexpected or malformed ResumeSessionPacket");
+    return;
+  }
+
+  InitialInfoPacket initial_info = std::move(*pending_initial_info_);
+  pending_initial_info_.reset();
+
+  if (!packet.player_id.has_value() || !player_manager_.HasLocalPlayer() ||
+      player_manager_.GetLocalPlayer().id() != static_cast<std::uint64_t>(*packet.player_id)) {
+    SPDLOG_INFO("Session could not be resumed, joining again");
+    // The players of the old session are announced again by the server if they are still around.
+    for (const auto& [player_id, player] : player_manager_.GetAllPlayers()) {
+      event_observer_.OnPlayerLeft(player_id, player->name());
+    }
+    player_manager_.Clear();
+    ApplyInitialInfo(initial_info);
+    return;
+  }
+
+  SPDLOG_INFO("Resumed the session of player {}", *packet.player_id);
+  resume_token_ = std::move(packet.resume_token);
+  resource_downloader_.SetDownloadToken(initial_info.resource_token);
+  is_in_game_ = true;
+  event_observer_.OnSessionResumed(player_manager_.GetLocalPlayer());
+}
+
+void GameClient::ApplyInitialInfo(InitialInfoPacket& packet) {
   SPDLOG_INFO("Initial info received: map='{}', base_path='{}', resources={}", packet.map_name,
               packet.resource_base_path.empty() ? "/public" : packet.resource_base_path, packet.client_resources.size());
 
+  resume_token_ = packet.resume_token;
   resource_downloader_.SetDownloadToken(packet.resource_token);
   resource_downloader_.SetBasePath(packet.resource_base_path.empty() ? "/public" : packet.resource_base_path);
   resource_downloader_.AnnounceResources(std::move(packet.client_resources));
 
   auto local_player = player_manager_.CreateLocalPlayer(packet.player_id);
   worlds_.clear();
+  snapshot_states_.clear();
   worlds_.emplace_back(packet.map_name);
 
   event_observer_.OnMapChange(packet.map_name);
@@ -399,13 +469,7 @@ void GameClient::OnActualStatistics(Packet p) {
     return;
   }
 
-  // Update the Player object with new state
-  Player* player = player_manager_.GetPlayer(*packet.player_id);
-  if (player) {
-    UpdatePlayerState(player, packet.state);
-  }
-
-  event_observer_.OnPlayerStateUpdate(*packet.player_id, packet.state);
+  ApplyRemotePlayerState(*packet.player_id, packet.state);
 }
 
 void GameClient::OnMapOnly(Packet p) {
@@ -418,7 +482,62 @@ void GameClient::OnMapOnly(Packet p) {
     return;
   }
 
-  event_observer_.OnPlayerPositionUpdate(*packet.player_id, packet.position.x, packet.position.z);
+  ApplyRemotePlayerPosition(*packet.player_id, packet.position);
+}
+
+void GameClient::OnBatch(Packet p) {
+  // Batched messages are handled in the order the server staged them, as if they had arrived one by one.
+  if (!Net::ForEachBatchedMessage(p.data, p.length, [this](unsigned char* data, std::uint32_t size) { HandlePacket(data, size); })) {
+    SPDLOG_ERROR("Malformed PT_BATCH packet of {} bytes", p.length);
+  }
+}
+
+void GameClient::OnPlayerSnapshot(Packet p) {
+  PlayerSnapshotPacket packet;
+  using InputAdapter = bitsery::InputBufferAdapter<unsigned char*>;
+  auto state = bitsery::quickDeserialization<InputAdapter>({p.data, p.length}, packet);
+
+  if (!state.second) {
+    SPDLOG_ERROR("Failed to deserialize PlayerSnapshotPacket");
+    return;
+  }
+
+  SPDLOG_TRACE("PlayerSnapshotPacket: {}", packet);
+
+  for (const auto& entry : packet.entries) {
+    RemoteSnapshotState& remote = snapshot_states_[entry.player_id];
+    switch (remote.Accept(entry)) {
+      case RemoteSnapshotState::Result::kApply:
+        if (entry.kind == SnapshotEntryKind::kPositionOnly) {
+          ApplyRemotePlayerPosition(entry.player_id, entry.position);
+        } else {
+          ApplyRemotePlayerState(entry.player_id, remote.GetState());
+        }
+        break;
+      case RemoteSnapshotState::Result::kStale:
+        // Snapshots may arrive out of order, this one was overtaken by a newer state of the player.
+        SPDLOG_TRACE("Dropping stale snapshot entry for player {}, tick {}", entry.player_id, entry.tick);
+        break;
+      case RemoteSnapshotState::Result::kMissingBaseline:
+        // The baseline got lost on the way, the server sends a new one shortly.
+        SPDLOG_TRACE("Dropping delta for player {}, missing baseline {}", entry.player_id, entry.baseline_sequence);
+        break;
+    }
+  }
+}
+
+void GameClient::ApplyRemotePlayerState(std::uint32_t player_id, const PlayerState& state) {
+  // Update the Player object with new state
+  Player* player = player_manager_.GetPlayer(player_id);
+  if (player) {
+    UpdatePlayerState(player, state);
+  }
+
+  event_observer_.OnPlayerStateUpdate(player_id, state);
+}
+
+void GameClient::ApplyRemotePlayerPosition(std::uint32_t player_id, const glm::vec3& position) {
+  event_observer_.OnPlayerPositionUpdate(player_id, position.x, position.z);
 }
 
 void GameClient::OnDoDie(Packet p) {
@@ -675,6 +794,7 @@ void GameClient::OnLeftGame(Packet p) {
 
   // Remove from player manager
   player_manager_.RemovePlayer(packet.disconnected_id);
+  snapshot_states_.erase(packet.disconnected_id);
 }
 
 void GameClient::OnDiscordActivity(Packet p) {
@@ -42,6 +42,7 @@ SOFTWARE.
 namespace {
 
 std::atomic<bool> g_should_exit{false};
+std::atomic<bool> g_dump_tick_profile{false};
 
 #ifdef _WIN32
 BOOL WINAPI HandlerRoutine(DWORD dwCtrlType) {
@@ -69,9 +70,14 @@ void HandlerRoutine(int /*signal*/) {
   g_should_exit.store(true, std::memory_order_release);
 }
 
+void DumpTickProfileHandler(int /*signal*/) {
+  g_dump_tick_profile.store(true, std::memory_order_release);
+}
+
 void RegisterSignalHandlers() {
   std::signal(SIGINT, HandlerRoutine);
   std::signal(SIGTERM, HandlerRoutine);
+  std::signal(SIGUSR1, DumpTickProfileHandler);
 }
 #endif
 
@@ -89,6 +95,9 @@ int main(int argc, char **argv) {
 
   while (!g_should_exit.load(std::memory_order_acquire)) {
     std::this_thread::sleep_for(std::chrono::seconds(1));
+    if (g_dump_tick_profile.exchange(false, std::memory_order_acq_rel)) {
+      serv.RequestTickProfileDump();
+    }
   }
 
   SPDLOG_INFO("Shutting down server...");
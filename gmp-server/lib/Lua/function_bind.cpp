@@ -173,6 +173,60 @@ bool Function_SpawnPlayer(std::uint32_t player_id, sol::variadic_args args) {
   return g_server->SpawnPlayer(player_id, position_override);
 }
 
+void Function_DumpTickProfile() {
+  if (!g_server) {
+    SPDLOG_WARN("Cannot dump the tick profile before the server is initialized");
+    return;
+  }
+
+  g_server->RequestTickProfileDump();
+}
+
+sol::optional<std::uint32_t> Function_FindPlayerByName(const std::string& name) {
+  if (!g_server) {
+    return sol::nullopt;
+  }
+
+  if (auto player_id = g_server->GetPlayerManager().FindPlayerByName(name)) {
+    return *player_id;
+  }
+  return sol::nullopt;
+}
+
+sol::as_table_t<std::vector<std::uint32_t>> Function_GetPlayersWithTag(const std::string& tag) {
+  if (!g_server) {
+    return sol::as_table(std::vector<std::uint32_t>{});
+  }
+
+  std::vector<std::uint32_t> players = g_server->GetPlayerManager().GetIndex().GetPlayersWithTag(tag);
+  return sol::as_table(std::move(players));
+}
+
+bool Function_AddPlayerTag(std::uint32_t player_id, const std::string& tag) {
+  if (!g_server) {
+    SPDLOG_WARN("Cannot tag players before the server is initialized");
+    return false;
+  }
+
+  return g_server->GetPlayerManager().AddTag(player_id, tag);
+}
+
+bool Function_RemovePlayerTag(std::uint32_t player_id, const std::string& tag) {
+  if (!g_server) {
+    return false;
+  }
+
+  return g_server->GetPlayerManager().RemoveTag(player_id, tag);
+}
+
+double Function_GetTickRate() {
+  if (!g_server) {
+    return 0.0;
+  }
+
+  return g_server->GetReplicationTickRate();
+}
+
 // Register Functions
 void lua::bindings::BindFunctions(sol::state& lua, TimerManager& timer_manager) {
   lua["Log"] = Function_Log;
@@ -180,6 +234,12 @@ void lua::bindings::BindFunctions(sol::state& lua, TimerManager& timer_manager)
   lua["SetDiscordActivity"] = Function_SetDiscordActivity;
   lua["SendServerMessage"] = Function_SendServerMessage;
   lua["spawnPlayer"] = Function_SpawnPlayer;
+  lua["dumpTickProfile"] = Function_DumpTickProfile;
+  lua["getTickRate"] = Function_GetTickRate;
+  lua["findPlayerByName"] = Function_FindPlayerByName;
+  lua["getPlayersWithTag"] = Function_GetPlayersWithTag;
+  lua["addPlayerTag"] = Function_AddPlayerTag;
+  lua["removePlayerTag"] = Function_RemovePlayerTag;
 
   lua["md5"] = Function_HashMd5;
   lua["sha1"] = Function_HashSha1;
@@ -0,0 +1,84 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <optional>
+
+#include "player_manager.h"
+#include "replication_lod.h"
+#include "spatial_grid.h"
+
+/**
+ * @brief Recipients of events that are only sent to the players around where they happen.
+ *
+ * A radius that is not positive means the event is sent to every in-game player.
+ */
+namespace area_events {
+
+/**
+ * @brief Whether a player standing at `position` is within `radius` of `origin`
+ */
+inline bool IsInArea(const glm::vec3& origin, const glm::vec3& position, float radius) {
+  return radius <= 0.0f || ReplicationLod::HorizontalDistance(origin, position) <= radius;
+}
+
+/**
+ * @brief Visits every in-game player within `radius` of `origin`
+ * @param func Function to call for each player (receives const PlayerManager::Player&)
+ */
+template <typename Func>
+void ForEachPlayerInArea(const PlayerManager& players, const SpatialGrid& grid, const glm::vec3& origin, float radius, Func&& func) {
+  if (radius <= 0.0f) {
+    players.ForEachIngamePlayer(func);
+    return;
+  }
+
+  grid.ForEachInRange(grid.CellFor(origin), grid.RingForRadius(radius), [&](PlayerManager::PlayerId player_id, const SpatialGrid::Cell&) {
+    auto position = players.GetIngamePosition(player_id);
+    if (position.has_value() && IsInArea(origin, *position, radius)) {
+      func(players.GetPlayer(player_id)->get());
+    }
+  });
+}
+
+/**
+ * @brief Visits every in-game player within `radius` of `origin`, and the in-game target of the event even when it is further away
+ * @param func Function to call for each player (receives const PlayerManager::Player&), at most once per player
+ */
+template <typename Func>
+void ForEachRecipient(const PlayerManager& players, const SpatialGrid& grid, const glm::vec3& origin, float radius,
+                      std::optional<PlayerManager::PlayerId> target_id, Func&& func) {
+  ForEachPlayerInArea(players, grid, origin, radius, func);
+  if (!target_id.has_value()) {
+    return;
+  }
+  auto position = players.GetIngamePosition(*target_id);
+  if (position.has_value() && !IsInArea(origin, *position, radius)) {
+    func(players.GetPlayer(*target_id)->get());
+  }
+}
+
+}  // namespace area_events
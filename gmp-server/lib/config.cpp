@@ -59,12 +59,30 @@ const std::unordered_map<std::string, std::variant<std::string, std::vector<std:
     {"map_md5", std::string("")},
     {"allow_modification", true},
     {"hide_map", false},
-    {"respawn_time_seconds", 5},
+    {"respawn_time_ms", 5000},
     {"log_file", std::string("log.txt")},
     {"log_to_stdout", true},
     {"log_level", std::string("trace")},
     {"scripts", std::vector<std::string>{std::string("main.lua")}},
-    {"tick_rate_ms", 100},
+    {"tick_rate_min_ms", 33},
+    {"tick_rate_max_ms", 100},
+    {"tick_rate_full_load_players", 150},
+    {"replication_max_bandwidth_kbps", 40000},
+    {"lod_near_radius", 1500},
+    {"lod_mid_radius", 5000},
+    {"lod_mid_interval_ticks", 2},
+    {"lod_far_interval_ticks", 10},
+    {"replication_budget_bytes", 4096},
+    {"replication_threads", 0},
+    {"replication_position_epsilon", 10},
+    {"replication_keep_alive_ticks", 50},
+    {"lag_compensation_ms", 500},
+    {"hit_max_range", 6000},
+    {"item_event_radius", 0},
+    {"spell_event_radius", 5000},
+    {"death_event_radius", 0},
+    {"join_snapshot_chunks_per_tick", 4},
+    {"session_resume_grace_ms", 0},
 #ifndef WIN32
     {"daemon", true}
 #else
@@ -130,6 +148,24 @@ void Config::Load() {
         },
         value.second);
   }
+
+  // respawn_time_seconds predates sub-second respawn delays, it is still honored if it is the only one set.
+  if (!config.GetValue<std::int32_t>("respawn_time_ms")) {
+    if (auto seconds = config.GetValue<std::int32_t>("respawn_time_seconds")) {
+      SPDLOG_WARN("respawn_time_seconds is deprecated, use respawn_time_ms instead");
+      values_["respawn_time_ms"] = *seconds < 0 ? -1 : *seconds * 1000;
+    }
+  }
+
+  // tick_rate_ms predates the adaptive tick rate, it is still honored as a fixed rate if neither bound is set.
+  if (!config.GetValue<std::int32_t>("tick_rate_min_ms") && !config.GetValue<std::int32_t>("tick_rate_max_ms")) {
+    if (auto tick_rate_ms = config.GetValue<std::int32_t>("tick_rate_ms")) {
+      SPDLOG_WARN("tick_rate_ms is deprecated, use tick_rate_min_ms and tick_rate_max_ms instead");
+      values_["tick_rate_min_ms"] = *tick_rate_ms;
+      values_["tick_rate_max_ms"] = *tick_rate_ms;
+    }
+  }
+
   ValidateAndFixValues();
   EnsureServerKeys();
 }
@@ -177,7 +213,8 @@ void Config::LogConfigValues() const {
   SPDLOG_INFO("* {:<18}: {}", "Map MD5", map_md5.empty() ? "<not set>" : map_md5);
   SPDLOG_INFO("* {:<18}: {}", "Allow modification", bool_to_string(Get<bool>("allow_modification")));
   SPDLOG_INFO("* {:<18}: {}", "Hide map", bool_to_string(Get<bool>("hide_map")));
-  SPDLOG_INFO("* {:<18}: {}", "Respawn time", fmt::format("{}s", Get<std::int32_t>("respawn_time_seconds")));
+  const auto respawn_time_ms = Get<std::int32_t>("respawn_time_ms");
+  SPDLOG_INFO("* {:<18}: {}", "Respawn time", respawn_time_ms < 0 ? std::string("disabled") : fmt::format("{} ms", respawn_time_ms));
 
   SPDLOG_INFO("");
   SPDLOG_INFO("-= Logging =-");
@@ -192,7 +229,25 @@ void Config::LogConfigValues() const {
 
   SPDLOG_INFO("");
   SPDLOG_INFO("-= Performance =-");
-  SPDLOG_INFO("* {:<18}: {} ms", "Tick rate", Get<std::int32_t>("tick_rate_ms"));
+  SPDLOG_INFO("* {:<18}: {} - {} ms", "Tick period", Get<std::int32_t>("tick_rate_min_ms"), Get<std::int32_t>("tick_rate_max_ms"));
+  SPDLOG_INFO("* {:<18}: {} players", "Full load at", Get<std::int32_t>("tick_rate_full_load_players"));
+  SPDLOG_INFO("* {:<18}: {} kbit/s", "Max bandwidth", Get<std::int32_t>("replication_max_bandwidth_kbps"));
+  SPDLOG_INFO("* {:<18}: {} / {} units", "LOD radii", Get<std::int32_t>("lod_near_radius"), Get<std::int32_t>("lod_mid_radius"));
+  SPDLOG_INFO("* {:<18}: {} / {} ticks", "LOD intervals", Get<std::int32_t>("lod_mid_interval_ticks"), Get<std::int32_t>("lod_far_interval_ticks"));
+  SPDLOG_INFO("* {:<18}: {} bytes per tick", "Replication budget", Get<std::int32_t>("replication_budget_bytes"));
+  SPDLOG_INFO("* {:<18}: {}", "Worker threads", Get<std::int32_t>("replication_threads"));
+  SPDLOG_INFO("* {:<18}: {} units", "Position epsilon", Get<std::int32_t>("replication_position_epsilon"));
+  SPDLOG_INFO("* {:<18}: {} ticks", "Keep-alive", Get<std::int32_t>("replication_keep_alive_ticks"));
+  SPDLOG_INFO("* {:<18}: {} ms", "Lag compensation", Get<std::int32_t>("lag_compensation_ms"));
+  SPDLOG_INFO("* {:<18}: {} units", "Hit range", Get<std::int32_t>("hit_max_range"));
+  SPDLOG_INFO("* {:<18}: item {} / spell {} / death {} units", "Event radii", Get<std::int32_t>("item_event_radius"),
+              Get<std::int32_t>("spell_event_radius"), Get<std::int32_t>("death_event_radius"));
+  SPDLOG_INFO("* {:<18}: {} chunks per tick", "Join streaming", Get<std::int32_t>("join_snapshot_chunks_per_tick"));
+  if (const auto resume_grace_ms = Get<std::int32_t>("session_resume_grace_ms"); resume_grace_ms > 0) {
+    SPDLOG_INFO("* {:<18}: {} ms", "Session resume", resume_grace_ms);
+  } else {
+    SPDLOG_INFO("* {:<18}: disabled", "Session resume");
+  }
 
 #ifndef WIN32
   const bool daemon = Get<bool>("daemon");
@@ -0,0 +1,91 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "connection_index.h"
+
+#include <utility>
+
+namespace {
+
+constexpr std::size_t kInitialCapacity = 64;
+
+}  // namespace
+
+void ConnectionIndex::Insert(Net::ConnectionHandle connection, Value value) {
+  // Kept at most half full, probe sequences stay short.
+  if ((size_ + 1) * 2 > entries_.size()) {
+    Grow();
+  }
+
+  for (std::size_t i = Home(connection);; i = (i + 1) & mask_) {
+    Entry& entry = entries_[i];
+    if (!entry.used) {
+      entry = Entry{connection, value, true};
+      ++size_;
+      return;
+    }
+    if (entry.connection == connection) {
+      entry.value = value;
+      return;
+    }
+  }
+}
+
+bool ConnectionIndex::Erase(Net::ConnectionHandle connection) {
+  if (size_ == 0) {
+    return false;
+  }
+
+  std::size_t hole = Home(connection);
+  while (entries_[hole].connection != connection || !entries_[hole].used) {
+    if (!entries_[hole].used) {
+      return false;
+    }
+    hole = (hole + 1) & mask_;
+  }
+
+  // Moves back every following entry of the cluster that would not be found from its home slot anymore.
+  for (std::size_t i = (hole + 1) & mask_; entries_[i].used; i = (i + 1) & mask_) {
+    const std::size_t home = Home(entries_[i].connection);
+    const bool reachable = ((i - home) & mask_) < ((i - hole) & mask_);
+    if (!reachable) {
+      entries_[hole] = entries_[i];
+      hole = i;
+    }
+  }
+  entries_[hole] = Entry{};
+  --size_;
+  return true;
+}
+
+void ConnectionIndex::Grow() {
+  std::vector<Entry> old = std::exchange(entries_, std::vector<Entry>(entries_.empty() ? kInitialCapacity : entries_.size() * 2));
+  mask_ = entries_.size() - 1;
+  size_ = 0;
+  for (const Entry& entry : old) {
+    if (entry.used) {
+      Insert(entry.connection, entry.value);
+    }
+  }
+}
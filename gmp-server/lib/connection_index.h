@@ -0,0 +1,105 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "znet_server.h"
+
+/**
+ * @brief Flat hash map from a connection handle to a 32-bit value.
+ *
+ * Open addressing with linear probing over a single array whose size is a power
+ * of two, so a lookup hashes once and usually reads one cache line. Removal
+ * shifts the following entries of the probe sequence back instead of leaving
+ * tombstones, so lookups do not slow down as players come and go.
+ */
+class ConnectionIndex {
+public:
+  using Value = std::uint32_t;
+
+  /**
+   * @brief Inserts the value, replacing the one stored for the connection
+   */
+  void Insert(Net::ConnectionHandle connection, Value value);
+
+  /**
+   * @return true if the connection was in the index
+   */
+  bool Erase(Net::ConnectionHandle connection);
+
+  std::optional<Value> Find(Net::ConnectionHandle connection) const {
+    if (size_ == 0) {
+      return std::nullopt;
+    }
+    for (std::size_t i = Home(connection);; i = (i + 1) & mask_) {
+      const Entry& entry = entries_[i];
+      if (!entry.used) {
+        return std::nullopt;
+      }
+      if (entry.connection == connection) {
+        return entry.value;
+      }
+    }
+  }
+
+  bool Contains(Net::ConnectionHandle connection) const {
+    return Find(connection).has_value();
+  }
+
+  std::size_t GetSize() const {
+    return size_;
+  }
+
+  void Clear() {
+    entries_.clear();
+    mask_ = 0;
+    size_ = 0;
+  }
+
+private:
+  struct Entry {
+    Net::ConnectionHandle connection{0};
+    Value value{0};
+    bool used{false};
+  };
+
+  std::size_t Home(Net::ConnectionHandle connection) const {
+    // Handles are often small sequential numbers, mixing spreads them over the table.
+    std::uint64_t hash = connection;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return static_cast<std::size_t>(hash) & mask_;
+  }
+
+  void Grow();
+
+  std::vector<Entry> entries_;
+  std::size_t mask_{0};
+  std::size_t size_{0};
+};
@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Drift-free fixed-timestep scheduler.
+ *
+ * Deadlines are derived from the start time and the period (start + n * period)
+ * instead of from the time the previous tick actually ran, so late ticks do not
+ * shift the schedule. When the caller falls behind by more than one period, the
+ * overdue ticks are either caught up (bounded by max_catch_up_ticks) or skipped,
+ * depending on the overrun policy. Every tick records its lateness, which makes
+ * jitter of the loop driving the scheduler measurable.
+ */
+class FixedTimestep {
+public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = Clock::duration;
+  using TimePoint = Clock::time_point;
+
+  enum class OverrunPolicy {
+    // Run every overdue tick, up to max_catch_up_ticks per Advance(), skip the rest.
+    kCatchUp,
+    // Run a single tick for any number of overdue ones, skip the rest.
+    kSkip,
+  };
+
+  struct Stats {
+    std::uint64_t ticks{0};
+    // Ticks that ran more than late_threshold after their deadline
+    std::uint64_t late_ticks{0};
+    // Ticks that were dropped because of an overrun
+    std::uint64_t skipped_ticks{0};
+    Duration worst_lateness{Duration::zero()};
+  };
+
+  /**
+   * @param period Time between two deadlines
+   * @param policy What to do with ticks that are overdue by more than a period
+   * @param start First deadline is one period after this
+   */
+  explicit FixedTimestep(Duration period, OverrunPolicy policy = OverrunPolicy::kSkip, TimePoint start = Clock::now())
+      : period_(std::max(period, Duration(1))), policy_(policy), next_deadline_(start + period_), late_threshold_(period_ / 10) {
+  }
+
+  /**
+   * @brief Consumes the ticks that are due at `now` and schedules the next deadline
+   * @return Number of ticks the caller has to run now, 0 if the next deadline has not been reached yet
+   */
+  std::uint32_t Advance(TimePoint now) {
+    if (now < next_deadline_) {
+      return 0;
+    }
+
+    const Duration lateness = now - next_deadline_;
+    const std::uint64_t overdue = static_cast<std::uint64_t>(lateness / period_) + 1;
+    const std::uint64_t max_ticks = policy_ == OverrunPolicy::kCatchUp ? max_catch_up_ticks_ : 1;
+    const std::uint64_t run = std::min(overdue, max_ticks);
+
+    // Every run tick is as late as its own deadline, the first one is the latest.
+    stats_.ticks += run;
+    stats_.skipped_ticks += overdue - run;
+    stats_.worst_lateness = std::max(stats_.worst_lateness, lateness);
+    for (std::uint64_t i = 0; i < run; ++i) {
+      if (lateness - period_ * static_cast<Duration::rep>(i) > late_threshold_) {
+        ++stats_.late_ticks;
+      }
+    }
+
+    next_deadline_ += period_ * static_cast<Duration::rep>(overdue);
+    return static_cast<std::uint32_t>(run);
+  }
+
+  /**
+   * @brief Changes the period, the next deadline is one new period after the last one
+   */
+  void SetPeriod(Duration period) {
+    next_deadline_ += std::max(period, Duration(1)) - period_;
+    period_ = std::max(period, Duration(1));
+    late_threshold_ = period_ / 10;
+  }
+
+  /**
+   * @brief Restarts the schedule, the first deadline is one period after `start`
+   */
+  void Reset(TimePoint start = Clock::now()) {
+    next_deadline_ = start + period_;
+  }
+
+  void SetMaxCatchUpTicks(std::uint32_t max_catch_up_ticks) {
+    max_catch_up_ticks_ = std::max<std::uint32_t>(1, max_catch_up_ticks);
+  }
+
+  void SetLateThreshold(Duration late_threshold) {
+    late_threshold_ = late_threshold;
+  }
+
+  TimePoint GetNextDeadline() const {
+    return next_deadline_;
+  }
+
+  Duration GetPeriod() const {
+    return period_;
+  }
+
+  const Stats& GetStats() const {
+    return stats_;
+  }
+
+  void ResetStats() {
+    stats_ = Stats{};
+  }
+
+private:
+  Duration period_;
+  OverrunPolicy policy_;
+  TimePoint next_deadline_;
+  Duration late_threshold_;
+  std::uint32_t max_catch_up_ticks_{5};
+  Stats stats_;
+};
@@ -32,9 +32,12 @@ SOFTWARE.
 #include <spdlog/spdlog.h>
 #include <version.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <charconv>
 #include <chrono>
+#include <cmath>
 #include <dylib.hpp>
 #include <filesystem>
 #include <fstream>
@@ -45,6 +48,7 @@ SOFTWARE.
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <random>
+#include <span>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -55,6 +59,7 @@ SOFTWARE.
 #include "net_enums.h"
 #include "packets.h"
 #include "platform_depend.h"
+#include "send_buffer.h"
 #include "server_events.h"
 #include "shared/event.h"
 #include "shared/math.h"
@@ -79,6 +84,13 @@ using namespace Net;
 namespace {
 
 constexpr const char* kBanListFileName = "bans.json";
+// Edge length of the spatial grid cells used for the replication proximity queries.
+constexpr float kGridCellSize = 5000.0f;
+// Period of the main loop driving the network pulse, the clock, script timers and respawns.
+constexpr std::chrono::milliseconds kSimulationPeriod{10};
+constexpr std::chrono::seconds kTickStatsLogInterval{60};
+// Replication ticks between two keyframes of the same player, see ReplicationBaselines.
+constexpr std::uint32_t kKeyframeIntervalTicks = 20;
 constexpr std::string_view kFrame = "-========================================-";
 
 #ifdef MASTER_SERVER_ENDPOINT
@@ -206,12 +218,32 @@ void LogServerBanner() {
   SPDLOG_INFO("-= GMP Team 2011-2025");
 }
 
-template <typename Packet, typename TContainer = std::vector<std::uint8_t>>
+template <typename Packet>
+std::span<const std::uint8_t> SerializeToBuffer(const Packet& packet, std::vector<std::uint8_t>& buffer) {
+  auto written_size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<std::vector<std::uint8_t>>>(buffer, packet);
+  return std::span<const std::uint8_t>(buffer.data(), written_size);
+}
+
+// Serializes whatever `func` writes, for packets that are encoded in parts.
+template <typename Func>
+std::span<const std::uint8_t> SerializePartToBuffer(std::vector<std::uint8_t>& buffer, Func&& func) {
+  bitsery::Serializer<bitsery::OutputBufferAdapter<std::vector<std::uint8_t>>> serializer{buffer};
+  func(serializer);
+  serializer.adapter().flush();
+  return std::span<const std::uint8_t>(buffer.data(), serializer.adapter().writtenBytesCount());
+}
+
+// Sends bytes that were already serialized, e.g. a payload shared between several recipients.
+void SendPayload(std::span<const std::uint8_t> payload, Net::PacketPriority priority, Net::PacketReliability reliable, Net::ConnectionHandle id,
+                 std::uint32_t channel = STREAM_DEFAULT) {
+  g_net_server->Send(payload, priority, reliable, channel, id);
+}
+
+template <typename Packet>
 void SerializeAndSend(const Packet& packet, Net::PacketPriority priority, Net::PacketReliability reliable, Net::ConnectionHandle id,
-                      std::uint32_t channel = 0) {
-  TContainer buffer;
-  auto written_size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<TContainer>>(buffer, packet);
-  g_net_server->Send(buffer.data(), written_size, priority, reliable, channel, id);
+                      std::uint32_t channel = STREAM_DEFAULT) {
+  SendBuffer buffer;
+  SendPayload(SerializeToBuffer(packet, buffer.Get()), priority, reliable, id, channel);
 }
 
 DiscordActivityPacket MakeDiscordActivityPacket(const GameServer::DiscordActivityState& activity) {
@@ -259,7 +291,11 @@ void InitializeLogger(const Config& config) {
 }
 }  // namespace
 
-GameServer::GameServer() {
+GameServer::GameServer()
+    : spatial_grid_(kGridCellSize),
+      simulation_timestep_(kSimulationPeriod),
+      replication_timestep_(std::chrono::milliseconds(100)),
+      replication_baselines_(kKeyframeIntervalTicks) {
   InitializeLogger(config_);
   LogServerBanner();
   config_.LogConfigValues();
@@ -281,6 +317,9 @@ GameServer::GameServer() {
   EventManager::Instance().RegisterEvent(kEventOnPlayerHitName);
 }
 
+GameServer::ReplicationWorker::ReplicationWorker(std::uint32_t budget_bytes) : scheduler(budget_bytes), snapshot_writer(PT_PLAYER_SNAPSHOT) {
+}
+
 GameServer::~GameServer() {
   g_is_server_running = false;
   if (main_thread.joinable()) {
@@ -317,6 +356,58 @@ bool GameServer::Init() {
   auto slots = config_.Get<std::int32_t>("slots");
   allow_modification = config_.Get<bool>("allow_modification");
 
+  area_event_radii_[static_cast<std::size_t>(AreaEvent::kItem)] = static_cast<float>(config_.Get<std::int32_t>("item_event_radius"));
+  area_event_radii_[static_cast<std::size_t>(AreaEvent::kSpell)] = static_cast<float>(config_.Get<std::int32_t>("spell_event_radius"));
+  area_event_radii_[static_cast<std::size_t>(AreaEvent::kDeath)] = static_cast<float>(config_.Get<std::int32_t>("death_event_radius"));
+
+  if (config_.Get<bool>("hide_map")) {
+    game_info_flags_ |= HIDE_MAP;
+  }
+
+  join_chunks_per_tick_ = static_cast<std::size_t>(std::max(1, config_.Get<std::int32_t>("join_snapshot_chunks_per_tick")));
+  resumable_sessions_ = ResumableSessions(std::chrono::milliseconds(std::max(0, config_.Get<std::int32_t>("session_resume_grace_ms"))));
+
+  const auto respawn_time_ms = config_.Get<std::int32_t>("respawn_time_ms");
+  if (respawn_time_ms >= 0) {
+    respawn_delay_ = std::chrono::milliseconds(respawn_time_ms);
+  }
+
+  ReplicationLod::Settings lod_settings;
+  lod_settings.near_radius = static_cast<float>(config_.Get<std::int32_t>("lod_near_radius"));
+  lod_settings.mid_radius = static_cast<float>(config_.Get<std::int32_t>("lod_mid_radius"));
+  lod_settings.mid_interval_ticks = static_cast<std::uint32_t>(std::max(1, config_.Get<std::int32_t>("lod_mid_interval_ticks")));
+  lod_settings.far_interval_ticks = static_cast<std::uint32_t>(std::max(1, config_.Get<std::int32_t>("lod_far_interval_ticks")));
+  replication_lod_ = ReplicationLod(lod_settings);
+
+  StateChangeTracker::Settings change_settings;
+  change_settings.position_epsilon = static_cast<float>(config_.Get<std::int32_t>("replication_position_epsilon"));
+  change_settings.keep_alive_ticks = static_cast<std::uint32_t>(std::max(1, config_.Get<std::int32_t>("replication_keep_alive_ticks")));
+  state_change_tracker_ = StateChangeTracker(change_settings);
+
+  TickRateController::Settings tick_rate_settings;
+  tick_rate_settings.min_period = std::chrono::milliseconds(std::max(1, config_.Get<std::int32_t>("tick_rate_min_ms")));
+  tick_rate_settings.max_period = std::chrono::milliseconds(std::max(1, config_.Get<std::int32_t>("tick_rate_max_ms")));
+  tick_rate_settings.full_load_players = static_cast<std::uint32_t>(std::max(0, config_.Get<std::int32_t>("tick_rate_full_load_players")));
+  tick_rate_settings.max_outbound_bytes_per_second =
+      static_cast<std::uint64_t>(std::max(0, config_.Get<std::int32_t>("replication_max_bandwidth_kbps"))) * 1000 / 8;
+  tick_rate_controller_ = TickRateController(tick_rate_settings);
+
+  // Enough frames to rewind the whole lag compensation window at the fastest tick rate, plus the two frames around its start.
+  const auto history_window = std::chrono::milliseconds(std::max(0, config_.Get<std::int32_t>("lag_compensation_ms")));
+  const auto history_tick = std::chrono::duration_cast<std::chrono::milliseconds>(tick_rate_settings.min_period);
+  player_history_ = PlayerHistory(static_cast<std::size_t>(history_window / history_tick) + 2, static_cast<std::size_t>(std::max(1, slots)));
+  hit_max_range_ = static_cast<float>(std::max(0, config_.Get<std::int32_t>("hit_max_range")));
+
+  const auto replication_budget = static_cast<std::uint32_t>(std::max(0, config_.Get<std::int32_t>("replication_budget_bytes")));
+  const auto replication_threads =
+      WorkerPool::ResolveWorkerCount(static_cast<std::uint32_t>(std::max(0, config_.Get<std::int32_t>("replication_threads"))));
+  replication_pool_ = std::make_unique<WorkerPool>(replication_threads);
+  replication_baselines_ = ReplicationBaselines(kKeyframeIntervalTicks, replication_threads);
+  replication_workers_.clear();
+  for (std::size_t i = 0; i < replication_threads; ++i) {
+    replication_workers_.push_back(std::make_unique<ReplicationWorker>(replication_budget));
+  }
+
   auto port = config_.Get<std::int32_t>("port");
 
   if (!g_net_server->Start(port, slots)) {
@@ -358,6 +449,7 @@ bool GameServer::Init() {
 
   try {
     client_resource_descriptors_ = ClientResourcePackager::Build(resource_manager_->GetDiscoveredResourceInfo());
+    initial_info_template_.Invalidate();
   } catch (const std::exception& ex) {
     SPDLOG_ERROR("Failed to pack client resources: {}", ex.what());
     return false;
@@ -372,13 +464,25 @@ bool GameServer::Init() {
     resource_manager_->LoadResource(resource_name, *lua_script_);
   }
 
-  last_update_time_ = std::chrono::steady_clock::now();
+  const auto start_time = FixedTimestep::Clock::now();
+  simulation_timestep_.Reset(start_time);
+  replication_timestep_.SetPeriod(tick_rate_controller_.GetPeriod());
+  logged_tick_rate_ = tick_rate_controller_.GetRate();
+  replication_timestep_.Reset(start_time);
+  next_tick_stats_log_ = start_time + kTickStatsLogInterval;
 
   main_thread_running.store(true, std::memory_order_release);
   main_thread = std::thread([this]() {
     while (main_thread_running.load(std::memory_order_acquire)) {
       Run();
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+      // Sleeps until the next tick, unless packets arrive earlier: those are handled right away by the next Run().
+      const auto deadline = std::min(simulation_timestep_.GetNextDeadline(), replication_timestep_.GetNextDeadline());
+      const auto now = FixedTimestep::Clock::now();
+      if (deadline > now) {
+        const auto timeout = std::chrono::ceil<std::chrono::microseconds>(deadline - now);
+        g_net_server->WaitForPackets(static_cast<std::uint32_t>(timeout.count()));
+      }
     }
   });
   SPDLOG_INFO("");
@@ -389,121 +493,310 @@ bool GameServer::Init() {
 }
 
 void GameServer::Run() {
-  constexpr double kRadius = 5000.0;
+  const auto now = FixedTimestep::Clock::now();
+  // Also runs between ticks, whenever the main loop is woken up by incoming packets.
+  {
+    TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kPulse);
+    g_net_server->Pulse();
+  }
 
-  g_net_server->Pulse();
-  clock_->RunClock();
+  // Clock, timers and respawns work off wall time, running them more than once per loop would not help.
+  if (simulation_timestep_.Advance(now) > 0) {
+    {
+      TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kClock);
+      clock_->RunClock();
+    }
 
-  if (lua_script_) {
-    lua_script_->ProcessTimers();
-  }
+    if (lua_script_) {
+      TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kTimers);
+      lua_script_->ProcessTimers();
+    }
 
-  ProcessRespawns();
+    {
+      TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kRespawns);
+      ProcessRespawns();
+    }
 
-  // Send updates to all players.
-  auto now = std::chrono::steady_clock::now();
-  if (now - last_update_time_ > std::chrono::milliseconds(config_.Get<std::int32_t>("tick_rate_ms"))) {
-    last_update_time_ = now;
-
-    // Pre-filter active players
-    std::vector<std::pair<PlayerId, const Player*>> active_players;
-    active_players.reserve(player_manager_.GetPlayerCount());
-    player_manager_.ForEachPlayer([&](const Player& player) {
-      if (player.is_ingame) {
-        active_players.emplace_back(player.player_id, &player);
-      }
+    {
+      TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kSessions);
+      ExpireSuspendedSessions();
+    }
+
+    // Joiners get the players that were already there spread over several ticks, so join storms do not stall the loop.
+    // Ordered with the join and leave notifications, a chunk must not bring back a player whose leave arrived first.
+    TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kJoinStreams);
+    join_snapshot_.Pump(join_chunks_per_tick_, [](Net::ConnectionHandle connection, std::span<const std::uint8_t> chunk) {
+      SendPayload(chunk, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, connection, STREAM_SESSION);
     });
+  }
 
-    using PlayersKey = std::pair<PlayerId, PlayerId>;
-    struct PlayersKeyHash {
-      std::size_t operator()(const PlayersKey& key) const {
-        std::hash<uint64_t> hasher;
-        return hasher(key.first) ^ (hasher(key.second) << 1);
-      }
-    };
+  // Send updates to all players.
+  const auto skipped_before = replication_timestep_.GetStats().skipped_ticks;
+  if (replication_timestep_.Advance(now) > 0) {
+    const auto replication_start = FixedTimestep::Clock::now();
+    std::size_t outbound_bytes = 0;
+    {
+      TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kReplication);
+      outbound_bytes = ReplicatePlayerStates();
+    }
+    AdaptTickRate(TickRateController::Sample{FixedTimestep::Clock::now() - replication_start, replicated_players_.size(), outbound_bytes});
 
-    struct PlayersKeyEqual {
-      bool operator()(const PlayersKey& lhs, const PlayersKey& rhs) const {
-        return lhs.first == rhs.first && lhs.second == rhs.second;
-      }
-    };
+    const auto skipped = replication_timestep_.GetStats().skipped_ticks - skipped_before;
+    if (skipped > 0) {
+      SPDLOG_WARN("Server loop fell behind, skipped {} replication tick(s)", skipped);
+    }
+  }
 
-    // Pre-allocate map with estimated size
-    std::unordered_map<PlayersKey, float, PlayersKeyHash, PlayersKeyEqual> distances;
-    distances.reserve((active_players.size() * (active_players.size() - 1)) / 2);
-    // Iteration over player pairs
-    for (size_t i = 0; i < active_players.size(); ++i) {
-      for (size_t j = i + 1; j < active_players.size(); ++j) {
-        PlayersKey key{std::min(active_players[i].first, active_players[j].first), std::max(active_players[i].first, active_players[j].first)};
+  {
+    TickProfiler::Scope scope(tick_profiler_, TickProfiler::Phase::kOutbound);
+    FlushOutboundBatches();
+  }
 
-        distances[key] = glm::distance(active_players[i].second->state.position, active_players[j].second->state.position);
-      }
+  if (tick_profile_dump_requested_.exchange(false, std::memory_order_acq_rel)) {
+    tick_profiler_.Log("Tick phases since the last report:", true);
+  }
+
+  if (now >= next_tick_stats_log_) {
+    LogTickStats();
+    next_tick_stats_log_ = now + kTickStatsLogInterval;
+  }
+}
+
+void GameServer::AdaptTickRate(const TickRateController::Sample& sample) {
+  const auto period = tick_rate_controller_.Update(sample);
+  if (period == replication_timestep_.GetPeriod()) {
+    return;
+  }
+  replication_timestep_.SetPeriod(period);
+
+  const double rate = tick_rate_controller_.GetRate();
+  if (std::abs(rate - logged_tick_rate_) >= logged_tick_rate_ * 0.2) {
+    SPDLOG_INFO("Replication tick rate changed to {:.1f} Hz ({} players, {:.2f} ms per tick, {} bytes queued)", rate, sample.player_count,
+                std::chrono::duration<double, std::milli>(sample.cost).count(), sample.outbound_bytes);
+    logged_tick_rate_ = rate;
+  }
+}
+
+void GameServer::FlushOutboundBatches() {
+  outbound_batcher_.Flush([](Net::ConnectionHandle connection, Net::PacketPriority priority, Net::PacketReliability reliability,
+                             std::uint32_t channel, std::span<const std::uint8_t> payload) {
+    SendPayload(payload, priority, reliability, connection, channel);
+  });
+}
+
+void GameServer::LogTickStats() {
+  auto log_stats = [](const char* name, FixedTimestep& timestep) {
+    const auto& stats = timestep.GetStats();
+    SPDLOG_DEBUG("{} ticks: {} run, {} late, {} skipped, worst lateness {:.2f} ms", name, stats.ticks, stats.late_ticks, stats.skipped_ticks,
+                 std::chrono::duration<double, std::milli>(stats.worst_lateness).count());
+    timestep.ResetStats();
+  };
+  log_stats("Simulation", simulation_timestep_);
+  log_stats("Replication", replication_timestep_);
+  SPDLOG_DEBUG("Replication tick rate: {:.1f} Hz", tick_rate_controller_.GetRate());
+  for (std::uint32_t stream = 0; stream < kStreamCount; ++stream) {
+    const auto stats = g_net_server->GetStreamStats(stream);
+    StreamStats& logged = logged_stream_stats_[stream];
+    const std::uint64_t messages = stats.messages - logged.messages;
+    if (messages > 0) {
+      SPDLOG_DEBUG("Stream {} ({}): {} messages, {} bytes sent", stream, StreamToString(stream), messages, stats.bytes - logged.bytes);
     }
+    logged = stats;
+  }
 
-    for (const auto& [players, distance] : distances) {
-      auto player_a_opt = player_manager_.GetPlayer(players.first);
-      auto player_b_opt = player_manager_.GetPlayer(players.second);
+  tick_profiler_.Log("Tick phases:", true);
+  tick_profiler_.Reset();
+}
 
-      if (!player_a_opt.has_value() || !player_b_opt.has_value()) {
-        continue;
-      }
+std::size_t GameServer::ReplicatePlayerStates() {
+  // The index is not cleared, its entries are overwritten and checked against replicated_players_ on lookup.
+  replicated_players_.clear();
+  const auto& ingame_ids = player_manager_.GetIngameIds();
+  const auto& ingame_positions = player_manager_.GetIngamePositions();
+  for (std::size_t i = 0; i < ingame_ids.size(); ++i) {
+    auto cell = spatial_grid_.GetCell(ingame_ids[i]);
+    if (!cell.has_value()) {
+      continue;
+    }
+    const Player& player = player_manager_.GetPlayer(ingame_ids[i])->get();
+    replicated_index_[ingame_ids[i]] = replicated_players_.size();
+    replicated_players_.push_back(ReplicatedPlayer{&player, ingame_ids[i], player.connection, ingame_positions[i], *cell, 0, 0});
+  }
+
+  // Every subject is encoded once per tick, recipients only get copies of the cached bytes. Deltas are
+  // taken against the subject's keyframe, which is shared by all recipients.
+  const std::uint64_t tick = ++replication_tick_;
+  encode_cache_.Clear();
+  player_history_.BeginFrame(tick, PlayerHistory::Clock::now());
+  for (auto& subject : replicated_players_) {
+    const Player& player = *subject.player;
+    player_history_.Record(player.player_id, PlayerHistory::Sample{player.state.position, player.state.animation, player.health});
+
+    PlayerState state = player.state;
+    state.health_points = player.health;
+    subject.revision = state_change_tracker_.Update(player.player_id, state, tick);
+    const auto& keyframe = replication_baselines_.RefreshKeyframe(player.player_id, state, tick);
+
+    PlayerSnapshotEntry entry;
+    entry.player_id = player.player_id;
+    entry.tick = static_cast<std::uint32_t>(keyframe.tick);
+    entry.baseline_sequence = keyframe.sequence;
+    entry.kind = SnapshotEntryKind::kFullState;
+    entry.state = keyframe.state;
+    encode_cache_.Store(player.player_id, StateEncodeCache::PayloadKind::kKeyframe, entry);
+
+    // The keyframe keeps the tick it was taken on, the other payloads are the state of this tick. A keyframe
+    // and a delta sent together are then applied in that order instead of the delta looking stale.
+    entry.tick = static_cast<std::uint32_t>(tick);
+    // A keyframe taken this tick already is the current state.
+    if (keyframe.tick != tick) {
+      entry.kind = SnapshotEntryKind::kDelta;
+      entry.delta = MakePlayerStateDelta(keyframe.state, state);
+      encode_cache_.Store(player.player_id, StateEncodeCache::PayloadKind::kDelta, entry);
+      subject.changed_field_count = static_cast<std::uint32_t>(std::popcount(entry.delta.changed_fields));
+    }
 
-      const auto& player_a = player_a_opt->get();
-      const auto& player_b = player_b_opt->get();
-
-      if (distance < kRadius) {
-        PlayerStateUpdatePacket player_a_update_packet;
-        player_a_update_packet.packet_type = PT_ACTUAL_STATISTICS;
-        player_a_update_packet.player_id = player_a.player_id;
-        player_a_update_packet.state = player_a.state;
-        player_a_update_packet.state.health_points = player_a.health;
-
-        PlayerStateUpdatePacket player_b_update_packet;
-        player_b_update_packet.packet_type = PT_ACTUAL_STATISTICS;
-        player_b_update_packet.player_id = player_b.player_id;
-        player_b_update_packet.state = player_b.state;
-        player_b_update_packet.state.health_points = player_b.health;
-
-        SerializeAndSend(player_a_update_packet, IMMEDIATE_PRIORITY, UNRELIABLE, player_b.connection);
-        SerializeAndSend(player_b_update_packet, IMMEDIATE_PRIORITY, UNRELIABLE, player_a.connection);
-      } else {
-        PlayerPositionUpdatePacket player_a_update_packet;
-        player_a_update_packet.packet_type = PT_MAP_ONLY;
-        player_a_update_packet.player_id = player_a.player_id;
-        player_a_update_packet.position = player_a.state.position;
-
-        PlayerPositionUpdatePacket player_b_update_packet;
-        player_b_update_packet.packet_type = PT_MAP_ONLY;
-        player_b_update_packet.player_id = player_b.player_id;
-        player_b_update_packet.position = player_b.state.position;
-
-        SerializeAndSend(player_a_update_packet, IMMEDIATE_PRIORITY, UNRELIABLE, player_b.connection);
-        SerializeAndSend(player_b_update_packet, IMMEDIATE_PRIORITY, UNRELIABLE, player_a.connection);
+    entry.kind = SnapshotEntryKind::kPositionOnly;
+    entry.position = player.state.position;
+    encode_cache_.Store(player.player_id, StateEncodeCache::PayloadKind::kMapOnly, entry);
+  }
+
+  // Everything within this many cells of the recipient may be inside the relevance radius, the exact
+  // distance decides the LOD tier of each subject.
+  const std::int32_t relevance_ring = spatial_grid_.RingForRadius(replication_lod_.GetRelevanceRadius());
+
+  // Recipients are partitioned over the workers by ID. Everything shared is only read until the workers
+  // are done, the keyframe bookkeeping they update is sharded the same way.
+  const std::size_t worker_count = replication_workers_.size();
+  auto replicate_shard = [&](std::size_t worker_index) {
+    ReplicationWorker& worker = *replication_workers_[worker_index];
+    for (const auto& recipient : replicated_players_) {
+      // Suspended players keep being replicated to the others, but have no connection to send to.
+      if (recipient.player_id % worker_count == worker_index && !resumable_sessions_.IsSuspended(recipient.player_id)) {
+        ReplicateToRecipient(recipient, worker, tick, relevance_ring);
       }
     }
+  };
+  // Passed by reference, the std::function would otherwise allocate a copy of the captures every tick.
+  replication_pool_->RunOnAll(std::ref(replicate_shard));
+
+  // NetServer makes no promise about concurrent sends, so the queued packets go out from here. Snapshots are
+  // unreliable and unordered, so a lost or late snapshot does not hold back the next one. Each entry carries
+  // its tick and the client drops the ones older than what it has for that player. The keyframes repair
+  // lost and dropped entries alike.
+  std::size_t outbound_bytes = 0;
+  for (auto& worker : replication_workers_) {
+    outbound_bytes += worker->outbound.GetByteCount();
+    worker->outbound.Drain([](Net::ConnectionHandle connection, std::span<const std::uint8_t> payload) {
+      SendPayload(payload, IMMEDIATE_PRIORITY, UNRELIABLE, connection, STREAM_MOVEMENT);
+    });
   }
+
+  return outbound_bytes;
 }
 
-void GameServer::ProcessRespawns() {
-  auto respawn_time = config_.Get<std::int32_t>("respawn_time_seconds");
-  if (respawn_time < 0) {
-    return;
+void GameServer::ReplicateToRecipient(const ReplicatedPlayer& recipient, ReplicationWorker& worker, std::uint64_t tick,
+                                      std::int32_t relevance_ring) {
+  const PlayerId recipient_id = recipient.player_id;
+  ReplicationScheduler& scheduler = worker.scheduler;
+  scheduler.BeginRecipient(recipient_id);
+
+  // Pairs that lost out on the budget earlier stay candidates until they are sent, even if their
+  // tier would not schedule them on this tick. Pairs the recipient already has the current revision
+  // of are left out entirely, which is what keeps idle players from costing bandwidth.
+  auto add_map_only = [&](const ReplicatedPlayer& subject) {
+    const PlayerId subject_id = subject.player_id;
+    if (!replication_lod_.IsDue(ReplicationLod::Tier::kFar, recipient_id, subject_id, tick) && !scheduler.IsCarriedOver(subject_id)) {
+      return;
+    }
+    if (scheduler.IsUpToDate(subject_id, ReplicationScheduler::Payload::kMapOnly, subject.revision)) {
+      return;
+    }
+    auto entry = encode_cache_.Get(subject_id, StateEncodeCache::PayloadKind::kMapOnly);
+    if (entry.has_value()) {
+      scheduler.AddCandidate(subject_id, ReplicationScheduler::Payload::kMapOnly, static_cast<std::uint32_t>(entry->size()),
+                             ReplicationScheduler::kMapOnlyWeight, subject.revision);
+    }
+  };
+
+  spatial_grid_.ForEachInRange(recipient.cell, relevance_ring, [&](PlayerId subject_id, const SpatialGrid::Cell&) {
+    if (subject_id == recipient_id) {
+      return;
+    }
+    auto index_it = replicated_index_.find(subject_id);
+    if (index_it == replicated_index_.end() || index_it->second >= replicated_players_.size() ||
+        replicated_players_[index_it->second].player_id != subject_id) {
+      return;
+    }
+
+    const ReplicatedPlayer& subject = replicated_players_[index_it->second];
+    const float distance = ReplicationLod::HorizontalDistance(recipient.position, subject.position);
+    const auto tier = replication_lod_.Classify(distance);
+    if (tier == ReplicationLod::Tier::kFar) {
+      add_map_only(subject);
+      return;
+    }
+    if (!replication_lod_.IsDue(tier, recipient_id, subject_id, tick) && !scheduler.IsCarriedOver(subject_id)) {
+      return;
+    }
+    if (scheduler.IsUpToDate(subject_id, ReplicationScheduler::Payload::kState, subject.revision)) {
+      return;
+    }
+
+    auto keyframe = encode_cache_.Get(subject_id, StateEncodeCache::PayloadKind::kKeyframe);
+    if (!keyframe.has_value()) {
+      return;
+    }
+    auto delta = encode_cache_.Get(subject_id, StateEncodeCache::PayloadKind::kDelta);
+    std::size_t size = delta.has_value() ? delta->size() : 0;
+    if (replication_baselines_.NeedsKeyframe(recipient_id, subject_id)) {
+      size += keyframe->size();
+    }
+    scheduler.AddCandidate(subject_id, ReplicationScheduler::Payload::kState, static_cast<std::uint32_t>(size),
+                           ReplicationScheduler::StateWeight(distance, subject.changed_field_count), subject.revision);
+  });
+
+  // The map shows every player, so the far ones still get their position.
+  for (const auto& subject : replicated_players_) {
+    if (SpatialGrid::CellDistance(recipient.cell, subject.cell) > relevance_ring) {
+      add_map_only(subject);
+    }
   }
 
-  auto now = std::time(nullptr);
+  auto flush = [&](std::span<const std::uint8_t> payload) { worker.outbound.Push(recipient.connection, payload); };
+  scheduler.SendSelected([&](PlayerId subject_id, ReplicationScheduler::Payload payload) {
+    if (payload == ReplicationScheduler::Payload::kMapOnly) {
+      worker.snapshot_writer.Append(*encode_cache_.Get(subject_id, StateEncodeCache::PayloadKind::kMapOnly), flush);
+      return;
+    }
+    if (replication_baselines_.MarkKeyframeSent(recipient_id, subject_id)) {
+      worker.snapshot_writer.Append(*encode_cache_.Get(subject_id, StateEncodeCache::PayloadKind::kKeyframe), flush);
+    }
+    auto delta = encode_cache_.Get(subject_id, StateEncodeCache::PayloadKind::kDelta);
+    if (delta.has_value()) {
+      worker.snapshot_writer.Append(*delta, flush);
+    }
+  });
+
+  worker.snapshot_writer.Finish(flush);
+}
 
-  player_manager_.ForEachPlayer([&](Player& player) {
+void GameServer::ProcessRespawns() {
+  respawn_queue_.PopDue(RespawnQueue::Clock::now(), [&](PlayerId player_id) {
+    auto player_opt = player_manager_.GetPlayer(player_id);
+    if (!player_opt.has_value()) {
+      return;
+    }
+    auto& player = player_opt->get();
     if (!player.is_ingame || player.tod == 0) {
       return;
     }
 
-    if (respawn_time == 0 || player.tod + respawn_time <= now) {
-      player.flags = 0;
-      player.tod = 0;
-      player.health = 100;
+    player.flags = 0;
+    player.tod = 0;
+    player.health = 100;
 
-      SendRespawnInfo(player.player_id);
-    }
+    SendRespawnInfo(player);
   });
 }
 
@@ -526,25 +819,7 @@ bool GameServer::HandlePacket(Net::ConnectionHandle connectionHandle, unsigned c
       PlayerId new_player_id = player_manager_.AddPlayer(p.id, "");
 
       // Send packet with initial information.
-      InitialInfoPacket packet;
-      packet.packet_type = PT_INITIAL_INFO;
-      packet.map_name = config_.Get<std::string>("map");
-      packet.player_id = new_player_id;
-      packet.resource_token = resource_server_->IssueToken(p.id);
-      packet.resource_base_path = "/public";
-      packet.client_resources.reserve(client_resource_descriptors_.size());
-      for (const auto& descriptor : client_resource_descriptors_) {
-        ClientResourceInfoEntry entry;
-        entry.name = descriptor.name;
-        entry.version = descriptor.version;
-        entry.manifest_path = descriptor.manifest_path;
-        entry.manifest_sha256 = descriptor.manifest_sha256;
-        entry.archive_path = descriptor.archive_path;
-        entry.archive_sha256 = descriptor.archive_sha256;
-        entry.archive_size = descriptor.archive_size;
-        packet.client_resources.push_back(std::move(entry));
-      }
-      SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE, p.id, 9);
+      SendInitialInfo(p.id, new_player_id);
     }
       SPDLOG_INFO("ID_NEW_INCOMING_CONNECTION from {} with connection {}. Now we have {} connected users.", g_net_server->GetPlayerIp(p.id), p.id,
                   player_manager_.GetPlayerCount());
@@ -553,6 +828,11 @@ bool GameServer::HandlePacket(Net::ConnectionHandle connectionHandle, unsigned c
       SPDLOG_WARN("ID_INCOMPATIBLE_PROTOCOL_VERSION");
       break;
     case ID_CONNECTION_LOST: {
+      if (TrySuspendSession(p.id)) {
+        SPDLOG_WARN("Connection lost from {}, keeping the session for {} ms.", g_net_server->GetPlayerIp(p.id),
+                    std::chrono::duration_cast<std::chrono::milliseconds>(resumable_sessions_.GetGracePeriod()).count());
+        break;
+      }
       auto player_opt = player_manager_.GetPlayerByConnection(p.id);
       if (player_opt.has_value()) {
         SendDisconnectionInfo(player_opt->get().player_id);
@@ -600,6 +880,9 @@ bool GameServer::HandlePacket(Net::ConnectionHandle connectionHandle, unsigned c
     case PT_VOICE:
       HandleVoice(p);
       break;
+    case PT_RESUME_SESSION:
+      HandleResumeSession(p);
+      break;
     default:
       SPDLOG_WARN("(S)He or it try to do something strange. It's packet ID: {}", packetIdentifier);
       break;
@@ -620,11 +903,24 @@ unsigned char GameServer::GetPacketIdentifier(const Packet& p) {
 }
 
 void GameServer::DeleteFromPlayerList(PlayerId player_id) {
+  spatial_grid_.Remove(player_id);
+  replication_baselines_.RemovePlayer(player_id);
+  state_change_tracker_.RemovePlayer(player_id);
+  encode_cache_.RemovePlayer(player_id);
+  join_snapshot_.Remove(player_id);
+  replicated_index_.erase(player_id);
+  respawn_queue_.Cancel(player_id);
+  resumable_sessions_.Forget(player_id);
+  for (auto& worker : replication_workers_) {
+    worker->scheduler.RemovePlayer(player_id);
+  }
   player_manager_.RemovePlayer(player_id);
 }
 
 void GameServer::HandlePlayerDisconnect(Net::ConnectionHandle connection) {
   resource_server_->RevokeToken(connection);
+  outbound_batcher_.RemoveConnection(connection);
+  join_snapshot_.CancelStream(connection);
 
   auto player_opt = player_manager_.GetPlayerByConnection(connection);
   if (player_opt.has_value()) {
@@ -636,6 +932,109 @@ void GameServer::HandlePlayerDisconnect(Net::ConnectionHandle connection) {
   }
 }
 
+bool GameServer::TrySuspendSession(Net::ConnectionHandle connection) {
+  auto player_opt = player_manager_.GetPlayerByConnection(connection);
+  if (!player_opt.has_value() || !resumable_sessions_.IsEnabled()) {
+    return false;
+  }
+  const PlayerId player_id = player_opt->get().player_id;
+
+  // Players that have not finished joining lose nothing by starting over, neither do joiners whose
+  // existing players stream was cut short, the delta sent on resume assumes they got all of it.
+  if (!join_snapshot_.Contains(player_id) || join_snapshot_.IsStreaming(connection)) {
+    return false;
+  }
+
+  std::vector<PlayerId> known_players;
+  player_manager_.ForEachPlayer([&](const Player& other) {
+    if (other.player_id != player_id && join_snapshot_.Contains(other.player_id)) {
+      known_players.push_back(other.player_id);
+    }
+  });
+  if (!resumable_sessions_.Suspend(player_id, std::move(known_players), ResumableSessions::Clock::now())) {
+    return false;
+  }
+
+  resource_server_->RevokeToken(connection);
+  outbound_batcher_.RemoveConnection(connection);
+  player_manager_.DetachConnection(player_id);
+  return true;
+}
+
+void GameServer::HandleResumeSession(Packet p) {
+  ResumeSessionPacket packet;
+  using InputAdapter = bitsery::InputBufferAdapter<unsigned char*>;
+  auto state = bitsery::quickDeserialization<InputAdapter>({p.data, p.length}, packet);
+  if (!state.second) {
+    SPDLOG_ERROR("Failed to deserialize ResumeSessionPacket from connection {}", p.id);
+    return;
+  }
+
+  // Only a fresh connection may take a player over, not one that already joined as someone else.
+  auto placeholder_opt = player_manager_.GetPlayerByConnection(p.id);
+  if (!placeholder_opt.has_value() || join_snapshot_.Contains(placeholder_opt->get().player_id)) {
+    SPDLOG_WARN("Connection {} tried to resume a session after joining the game", p.id);
+    return;
+  }
+  const PlayerId placeholder_id = placeholder_opt->get().player_id;
+
+  ResumeSessionPacket reply;
+  reply.packet_type = PT_RESUME_SESSION;
+  auto session = resumable_sessions_.Resume(packet.resume_token, ResumableSessions::Clock::now());
+  if (!session.has_value() || !player_manager_.HasPlayer(session->player_id)) {
+    // The client joins from scratch with the initial info it already got.
+    SerializeAndSend(reply, HIGH_PRIORITY, RELIABLE_ORDERED, p.id, STREAM_SESSION);
+    return;
+  }
+
+  const PlayerId player_id = session->player_id;
+  DeleteFromPlayerList(placeholder_id);
+  player_manager_.AttachConnection(player_id, p.id);
+  // Keyframes sent over the old connection may have been lost with it.
+  replication_baselines_.ForgetRecipient(player_id);
+
+  reply.player_id = player_id;
+  reply.resume_token = resumable_sessions_.IssueToken(player_id);
+  SerializeAndSend(reply, HIGH_PRIORITY, RELIABLE_ORDERED, p.id, STREAM_SESSION);
+
+  // Only what changed while the client was away: the players that left and the ones that joined.
+  auto& known_players = session->known_players;
+  std::sort(known_players.begin(), known_players.end());
+
+  DisconnectionInfoPacket left_packet;
+  left_packet.packet_type = PT_LEFT_GAME;
+  std::size_t left_count = 0;
+  for (PlayerId known_id : known_players) {
+    if (!join_snapshot_.Contains(known_id)) {
+      left_packet.disconnected_id = known_id;
+      SerializeAndSend(left_packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, p.id, STREAM_SESSION);
+      ++left_count;
+    }
+  }
+
+  std::vector<PlayerId> joined_players;
+  player_manager_.ForEachPlayer([&](const Player& other) {
+    if (other.player_id != player_id && join_snapshot_.Contains(other.player_id) &&
+        !std::binary_search(known_players.begin(), known_players.end(), other.player_id)) {
+      joined_players.push_back(other.player_id);
+    }
+  });
+  const std::size_t joined_count = joined_players.size();
+  join_snapshot_.StartStream(p.id, std::move(joined_players));
+
+  SPDLOG_INFO("{} resumed the session of player {} ({} left and {} joined meanwhile)", g_net_server->GetPlayerIp(p.id), player_id, left_count,
+              joined_count);
+}
+
+void GameServer::ExpireSuspendedSessions() {
+  resumable_sessions_.ExpireDue(ResumableSessions::Clock::now(), [&](PlayerId player_id) {
+    SPDLOG_INFO("Session of player {} expired before it was resumed", player_id);
+    SendDisconnectionInfo(player_id);
+    EventManager::Instance().TriggerEvent(kEventOnPlayerDisconnectName, player_id);
+    DeleteFromPlayerList(player_id);
+  });
+}
+
 void GameServer::HandlePlayerDeath(Player& victim, std::optional<PlayerId> killer_id) {
   if (victim.tod != 0) {
     return;
@@ -644,6 +1043,9 @@ void GameServer::HandlePlayerDeath(Player& victim, std::optional<PlayerId> kille
   victim.health = 0;
   victim.state.health_points = 0;
   victim.tod = time(NULL);
+  if (respawn_delay_.has_value()) {
+    respawn_queue_.Schedule(victim.player_id, RespawnQueue::Clock::now() + *respawn_delay_);
+  }
 
   if (killer_id.has_value() && killer_id.value() != victim.player_id) {
     EventManager::Instance().TriggerEvent(kEventOnPlayerKillName, OnPlayerKillEvent{killer_id.value(), victim.player_id});
@@ -651,7 +1053,7 @@ void GameServer::HandlePlayerDeath(Player& victim, std::optional<PlayerId> kille
 
   EventManager::Instance().TriggerEvent(kEventOnPlayerDeathName, OnPlayerDeathEvent{victim.player_id, killer_id});
 
-  SendDeathInfo(victim.player_id);
+  SendDeathInfo(victim);
 }
 
 void GameServer::SomeoneJoinGame(Packet p) {
@@ -665,7 +1067,7 @@ void GameServer::SomeoneJoinGame(Packet p) {
   if (!allow_modification) {
     if (!player.passed_crc_test) {
       resource_server_->RevokeToken(p.id);
-      player_manager_.RemovePlayerByConnection(p.id);
+      DeleteFromPlayerList(player.player_id);
       g_net_server->AddToBanList(p.id, 3600000);  // i dorzucamy banana na 1h
       return;
     }
@@ -676,7 +1078,7 @@ void GameServer::SomeoneJoinGame(Packet p) {
   auto state = bitsery::quickDeserialization<InputAdapter>({p.data, p.length}, packet);
   SPDLOG_TRACE("{} from {}", packet, p.id);
 
-  player.state.position = packet.position;
+  player_manager_.SetPosition(player.player_id, packet.position);
   player.state.nrot = packet.normal;
   player.state.left_hand_item_instance = packet.left_hand_item_instance;
   player.state.right_hand_item_instance = packet.right_hand_item_instance;
@@ -686,10 +1088,11 @@ void GameServer::SomeoneJoinGame(Packet p) {
   player.skin = packet.skin_texture;
   player.body = packet.face_texture;
   player.walkstyle = packet.walk_style;
-  player.name = packet.player_name;
+  player_manager_.SetPlayerName(player.player_id, packet.player_name);
 
   // Inform the joining player about already spawned players before any spawn happens
   SendExistingPlayersPacket(player);
+  UpdateJoinSnapshot(player);
 
   BroadcastPlayerJoined(player);
 
@@ -698,8 +1101,6 @@ void GameServer::SomeoneJoinGame(Packet p) {
 }
 
 void GameServer::HandlePlayerUpdate(Packet p) {
-  constexpr double kRadiusSquared = 5000.0 * 5000.0;
-
   auto player_opt = player_manager_.GetPlayerByConnection(p.id);
   if (!player_opt.has_value()) {
     return;
@@ -710,7 +1111,44 @@ void GameServer::HandlePlayerUpdate(Packet p) {
   using InputAdapter = bitsery::InputBufferAdapter<unsigned char*>;
   auto state = bitsery::quickDeserialization<InputAdapter>({p.data, p.length}, packet);
 
-  updated_player.state = packet.state;
+  const bool equipment_changed = updated_player.state.left_hand_item_instance != packet.state.left_hand_item_instance ||
+                                 updated_player.state.right_hand_item_instance != packet.state.right_hand_item_instance ||
+                                 updated_player.state.equipped_armor_instance != packet.state.equipped_armor_instance;
+  player_manager_.SetState(updated_player.player_id, packet.state);
+  if (equipment_changed && join_snapshot_.Contains(updated_player.player_id)) {
+    UpdateJoinSnapshot(updated_player);
+  } else {
+    join_snapshot_.UpdatePosition(updated_player.player_id, updated_player.state.position);
+  }
+  if (updated_player.is_ingame) {
+    spatial_grid_.Update(updated_player.player_id, updated_player.state.position);
+  }
+}
+
+bool GameServer::IsPlausibleHit(const Player& attacker, const Player& victim) const {
+  if (hit_max_range_ <= 0.0f) {
+    return true;
+  }
+
+  // The attacker acted on a world that was half a round trip old when it sent the hit, and remote players
+  // are shown about one replication tick behind.
+  const std::int32_t ping = std::max(0, g_net_server->GetAveragePing(attacker.connection));
+  const auto view_time = PlayerHistory::Clock::now() - std::chrono::milliseconds(ping / 2) - replication_timestep_.GetPeriod();
+
+  switch (player_history_.CheckHit(attacker.player_id, victim.player_id, view_time, hit_max_range_)) {
+    case PlayerHistory::HitCheck::kValid:
+      return true;
+    case PlayerHistory::HitCheck::kNoHistory:
+      // Players that just spawned are not recorded until the next replication tick.
+      return true;
+    case PlayerHistory::HitCheck::kOutOfRange:
+      SPDLOG_DEBUG("Rejected hit of {} on {}: out of range", attacker.player_id, victim.player_id);
+      return false;
+    case PlayerHistory::HitCheck::kVictimDead:
+      SPDLOG_DEBUG("Rejected hit of {} on {}: victim was already dead", attacker.player_id, victim.player_id);
+      return false;
+  }
+  return false;
 }
 
 void GameServer::MakeHPDiff(Packet p) {
@@ -737,6 +1175,10 @@ void GameServer::MakeHPDiff(Packet p) {
       return;
     }
 
+    if (victim_player_id != attacker.player_id && !IsPlausibleHit(attacker, victim)) {
+      return;
+    }
+
     std::optional<PlayerId> killer_id;
     if (victim_player_id != attacker.player_id) {
       killer_id = attacker.player_id;
@@ -772,12 +1214,11 @@ void GameServer::MakeHPDiff(Packet p) {
 
 void GameServer::HandleVoice(Packet p) {
   // TODO: no need to resend player id right now, it won't be needed until we add 3d chat
-  std::string data;
-  data.reserve(p.length);
-  memcpy(data.data(), p.data, p.length);
+  // The received packet stays valid until the handler returns, so it is relayed as is.
+  const std::span<const std::uint8_t> payload(p.data, p.length);
   player_manager_.ForEachIngamePlayer([&](const Player& existing_player) {
     if (existing_player.connection != p.id) {
-      g_net_server->Send((unsigned char*)data.data(), p.length, IMMEDIATE_PRIORITY, UNRELIABLE, 5, existing_player.connection);
+      SendPayload(payload, IMMEDIATE_PRIORITY, UNRELIABLE, existing_player.connection, STREAM_VOICE);
     }
   });
 }
@@ -805,8 +1246,11 @@ void GameServer::HandleNormalMsg(Packet p) {
   EventManager::Instance().TriggerEvent(kEventOnPlayerMessageName, OnPlayerMessageEvent{player.player_id, packet.message});
 
   packet.sender = player.player_id;
-  player_manager_.ForEachIngamePlayer(
-      [&](const Player& existing_player) { SerializeAndSend(packet, LOW_PRIORITY, RELIABLE_ORDERED, existing_player.connection); });
+  SendBuffer buffer;
+  const auto payload = SerializeToBuffer(packet, buffer.Get());
+  player_manager_.ForEachIngamePlayer([&](const Player& existing_player) {
+    outbound_batcher_.Stage(existing_player.connection, LOW_PRIORITY, RELIABLE_ORDERED, STREAM_CHAT, payload);
+  });
 
   SPDLOG_INFO("{}", packet);
 }
@@ -835,8 +1279,10 @@ void GameServer::HandleWhisp(Packet p) {
 
   EventManager::Instance().TriggerEvent(kEventOnPlayerWhisperName, OnPlayerWhisperEvent{player.player_id, recipient.player_id, packet.message});
 
-  SerializeAndSend(packet, LOW_PRIORITY, RELIABLE_ORDERED, player.connection);
-  SerializeAndSend(packet, LOW_PRIORITY, RELIABLE_ORDERED, recipient.connection);
+  SendBuffer buffer;
+  const auto payload = SerializeToBuffer(packet, buffer.Get());
+  outbound_batcher_.Stage(player.connection, LOW_PRIORITY, RELIABLE_ORDERED, STREAM_CHAT, payload);
+  outbound_batcher_.Stage(recipient.connection, LOW_PRIORITY, RELIABLE_ORDERED, STREAM_CHAT, payload);
 
   SPDLOG_INFO("({} WHISPERS TO {}) {}", player.name, recipient.name, (const char*)(p.data + 1 + sizeof(PlayerId)));
 }
@@ -867,9 +1313,22 @@ void GameServer::HandleCastSpell(Packet p, bool target) {
 
   EventManager::Instance().TriggerEvent(kEventOnPlayerCastSpellName, OnPlayerCastSpellEvent{player.player_id, packet.spell_id, packet.target_id});
 
-  player_manager_.ForEachIngamePlayer([&](const Player& existing_player) {
-    if (existing_player.player_id != player.player_id) {
-      SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE, existing_player.connection);
+  // The target has to see the spell even when it was cast from further away than the spell radius.
+  BroadcastToArea(packet, AreaEvent::kSpell, player.state.position, HIGH_PRIORITY, RELIABLE, STREAM_COMBAT, player.player_id,
+                  target ? packet.target_id : std::nullopt);
+}
+
+template <typename Packet>
+void GameServer::BroadcastToArea(const Packet& packet, AreaEvent event, const glm::vec3& origin, Net::PacketPriority priority,
+                                 Net::PacketReliability reliability, std::uint32_t channel, std::optional<PlayerId> excluded_player_id,
+                                 std::optional<PlayerId> target_player_id) {
+  SendBuffer buffer;
+  const auto payload = SerializeToBuffer(packet, buffer.Get());
+
+  const float radius = area_event_radii_[static_cast<std::size_t>(event)];
+  area_events::ForEachRecipient(player_manager_, spatial_grid_, origin, radius, target_player_id, [&](const Player& player) {
+    if (player.player_id != excluded_player_id) {
+      outbound_batcher_.Stage(player.connection, priority, reliability, channel, payload);
     }
   });
 }
@@ -889,11 +1348,7 @@ void GameServer::HandleDropItem(Packet p) {
   EventManager::Instance().TriggerEvent(kEventOnPlayerDropItemName,
                                         OnPlayerDropItemEvent{player.player_id, packet.item_instance, packet.item_amount});
 
-  player_manager_.ForEachIngamePlayer([&](const Player& existing_player) {
-    if (existing_player.player_id != player.player_id) {
-      SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE, existing_player.connection);
-    }
-  });
+  BroadcastToArea(packet, AreaEvent::kItem, player.state.position, HIGH_PRIORITY, RELIABLE, STREAM_DEFAULT, player.player_id, std::nullopt);
   SPDLOG_INFO("{} DROPPED ITEM. AMOUNT: {}", player.name, packet.item_amount);
 }
 
@@ -911,11 +1366,7 @@ void GameServer::HandleTakeItem(Packet p) {
 
   EventManager::Instance().TriggerEvent(kEventOnPlayerTakeItemName, OnPlayerTakeItemEvent{player.player_id, packet.item_instance});
 
-  player_manager_.ForEachIngamePlayer([&](const Player& existing_player) {
-    if (existing_player.player_id != player.player_id) {
-      SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE, existing_player.connection);
-    }
-  });
+  BroadcastToArea(packet, AreaEvent::kItem, player.state.position, HIGH_PRIORITY, RELIABLE, STREAM_DEFAULT, player.player_id, std::nullopt);
   SPDLOG_INFO("{} TOOK ITEM.", player.name);
 }
 
@@ -996,22 +1447,62 @@ void GameServer::SendGameInfo(Net::ConnectionHandle who) {
   packet.packet_type = PT_GAME_INFO;
   GothicClock::TimeUnion game_time = clock_->GetTime();
   packet.raw_game_time = game_time.raw;
+  packet.flags = game_info_flags_;
 
-  if (config_.Get<bool>("hide_map")) {
-    packet.flags |= HIDE_MAP;
+  SerializeAndSend(packet, MEDIUM_PRIORITY, RELIABLE_ORDERED, who, STREAM_SESSION);
+}
+
+void GameServer::SendInitialInfo(Net::ConnectionHandle connection, PlayerId player_id) {
+  if (!initial_info_template_.IsValid()) {
+    BuildInitialInfoTemplate();
+  }
+
+  InitialInfoPacket packet;
+  packet.player_id = player_id;
+  packet.resource_token = resource_server_->IssueToken(connection);
+  packet.resume_token = resumable_sessions_.IssueToken(player_id);
+
+  SendBuffer fields_buffer;
+  const auto fields = SerializePartToBuffer(fields_buffer.Get(), [&](auto& s) { SerializeInitialInfoConnectionFields(s, packet); });
+  SendBuffer buffer;
+  SendPayload(initial_info_template_.Assemble(fields, buffer.Get()), HIGH_PRIORITY, RELIABLE_ORDERED, connection, STREAM_SESSION);
+}
+
+void GameServer::BuildInitialInfoTemplate() {
+  InitialInfoPacket packet;
+  packet.packet_type = PT_INITIAL_INFO;
+  packet.map_name = config_.Get<std::string>("map");
+  packet.resource_base_path = "/public";
+  packet.client_resources.reserve(client_resource_descriptors_.size());
+  for (const auto& descriptor : client_resource_descriptors_) {
+    ClientResourceInfoEntry entry;
+    entry.name = descriptor.name;
+    entry.version = descriptor.version;
+    entry.manifest_path = descriptor.manifest_path;
+    entry.manifest_sha256 = descriptor.manifest_sha256;
+    entry.archive_path = descriptor.archive_path;
+    entry.archive_sha256 = descriptor.archive_sha256;
+    entry.archive_size = descriptor.archive_size;
+    packet.client_resources.push_back(std::move(entry));
   }
 
-  SerializeAndSend(packet, MEDIUM_PRIORITY, RELIABLE, who, 9);
+  std::vector<std::uint8_t> head_buffer;
+  std::vector<std::uint8_t> tail_buffer;
+  initial_info_template_.Set(SerializePartToBuffer(head_buffer, [&](auto& s) { SerializeInitialInfoHead(s, packet); }),
+                             SerializePartToBuffer(tail_buffer, [&](auto& s) { SerializeInitialInfoTail(s, packet); }));
 }
 
 void GameServer::UpdateDiscordActivity(const DiscordActivityState& activity) {
   discord_activity_ = activity;
-  discord_activity_initialized_ = true;
 
   SPDLOG_INFO("Discord activity updated: state='{}', details='{}'", discord_activity_.state, discord_activity_.details);
 
   auto packet = MakeDiscordActivityPacket(discord_activity_);
-  player_manager_.ForEachIngamePlayer([&](const Player& player) { SerializeAndSend(packet, LOW_PRIORITY, RELIABLE, player.connection); });
+  SendBuffer buffer;
+  const auto payload = SerializeToBuffer(packet, buffer.Get());
+  discord_activity_payload_.assign(payload.begin(), payload.end());
+  player_manager_.ForEachIngamePlayer(
+      [&](const Player& player) { outbound_batcher_.Stage(player.connection, LOW_PRIORITY, RELIABLE, STREAM_DEFAULT, payload); });
 }
 
 const GameServer::DiscordActivityState& GameServer::GetDiscordActivity() const {
@@ -1019,12 +1510,11 @@ const GameServer::DiscordActivityState& GameServer::GetDiscordActivity() const {
 }
 
 void GameServer::SendDiscordActivity(Net::ConnectionHandle handle) {
-  if (!discord_activity_initialized_) {
+  if (discord_activity_payload_.empty()) {
     return;
   }
 
-  auto packet = MakeDiscordActivityPacket(discord_activity_);
-  SerializeAndSend(packet, LOW_PRIORITY, RELIABLE, handle);
+  SendPayload(discord_activity_payload_, LOW_PRIORITY, RELIABLE, handle);
 }
 
 void GameServer::HandleMapNameReq(Packet p) {
@@ -1037,7 +1527,7 @@ void GameServer::SendDisconnectionInfo(PlayerId disconnected_player_id) {
 
   player_manager_.ForEachIngamePlayer([&](const Player& player) {
     if (player.player_id != disconnected_player_id) {
-      SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE, player.connection);
+      SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, player.connection, STREAM_SESSION);
     }
   });
 }
@@ -1055,23 +1545,34 @@ void GameServer::SendServerMessage(const std::string& message) {
   packet.packet_type = PT_SRVMSG;
   packet.message = message;
 
-  player_manager_.ForEachIngamePlayer([&](const Player& player) { SerializeAndSend(packet, MEDIUM_PRIORITY, RELIABLE, player.connection, 11); });
+  SendBuffer buffer;
+  const auto payload = SerializeToBuffer(packet, buffer.Get());
+  player_manager_.ForEachIngamePlayer(
+      [&](const Player& player) { outbound_batcher_.Stage(player.connection, MEDIUM_PRIORITY, RELIABLE, STREAM_CHAT, payload); });
 }
 
-void GameServer::SendDeathInfo(PlayerId dead_player_id) {
+void GameServer::SendDeathInfo(const Player& dead_player) {
   PlayerDeathInfoPacket packet;
   packet.packet_type = PT_DODIE;
-  packet.player_id = dead_player_id;
+  packet.player_id = dead_player.player_id;
 
-  player_manager_.ForEachIngamePlayer([&](const Player& player) { SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE, player.connection, 13); });
+  // Ordered on the combat stream, a respawn must never overtake the death it follows.
+  BroadcastToArea(packet, AreaEvent::kDeath, dead_player.state.position, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, STREAM_COMBAT, std::nullopt,
+                  std::nullopt);
 }
 
-void GameServer::SendRespawnInfo(PlayerId respawned_player_id) {
+void GameServer::SendRespawnInfo(const Player& respawned_player) {
   PlayerRespawnInfoPacket packet;
   packet.packet_type = PT_RESPAWN;
-  packet.player_id = respawned_player_id;
+  packet.player_id = respawned_player.player_id;
 
-  player_manager_.ForEachIngamePlayer([&](const Player& player) { SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE, player.connection, 13); });
+  // Sent to everyone, not only around the death: a player who saw the death and walked out of range since
+  // would otherwise keep a corpse around. Players who never got the death see a respawn of someone alive.
+  SendBuffer buffer;
+  const auto payload = SerializeToBuffer(packet, buffer.Get());
+  player_manager_.ForEachIngamePlayer([&](const Player& player) {
+    outbound_batcher_.Stage(player.connection, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, STREAM_COMBAT, payload);
+  });
 }
 
 void GameServer::BroadcastPlayerJoined(const Player& joining_player) {
@@ -1094,44 +1595,35 @@ void GameServer::BroadcastPlayerJoined(const Player& joining_player) {
     if (existing_player.player_id == joining_player.player_id) {
       return;
     }
-    SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE, existing_player.connection);
+    SerializeAndSend(packet, HIGH_PRIORITY, RELIABLE_ORDERED, existing_player.connection, STREAM_SESSION);
   });
 }
 
 void GameServer::SendExistingPlayersPacket(const Player& target_player) {
-  std::vector<ExistingPlayerInfo> existing_players;
-  player_manager_.ForEachPlayer([&](const Player& existing_player) {
-    if (existing_player.player_id == target_player.player_id) {
-      return;
-    }
-
-    // Skip players that have not finished the join handshake yet
-    if (existing_player.name.empty()) {
-      return;
-    }
-
-    ExistingPlayerInfo player_packet;
-    player_packet.player_id = existing_player.player_id;
-    player_packet.position = existing_player.state.position;
-    player_packet.left_hand_item_instance = existing_player.state.left_hand_item_instance;
-    player_packet.right_hand_item_instance = existing_player.state.right_hand_item_instance;
-    player_packet.equipped_armor_instance = existing_player.state.equipped_armor_instance;
-    player_packet.head_model = existing_player.head;
-    player_packet.skin_texture = existing_player.skin;
-    player_packet.face_texture = existing_player.body;
-    player_packet.walk_style = existing_player.walkstyle;
-    player_packet.player_name = existing_player.name;
-    existing_players.push_back(std::move(player_packet));
-  });
+  join_snapshot_.StartStream(target_player.connection, target_player.player_id);
+}
 
-  if (existing_players.empty()) {
+void GameServer::UpdateJoinSnapshot(const Player& player) {
+  // Skip players that have not finished the join handshake yet
+  if (player.name.empty()) {
+    join_snapshot_.Remove(player.player_id);
     return;
   }
 
-  ExistingPlayersPacket existing_players_packet;
-  existing_players_packet.packet_type = PT_EXISTING_PLAYERS;
-  existing_players_packet.existing_players = std::move(existing_players);
-  SerializeAndSend(existing_players_packet, IMMEDIATE_PRIORITY, RELIABLE, target_player.connection);
+  ExistingPlayerInfo info;
+  info.player_id = player.player_id;
+  info.position = player.state.position;
+  info.left_hand_item_instance = player.state.left_hand_item_instance;
+  info.right_hand_item_instance = player.state.right_hand_item_instance;
+  info.equipped_armor_instance = player.state.equipped_armor_instance;
+  info.head_model = player.head;
+  info.skin_texture = player.skin;
+  info.face_texture = player.body;
+  info.walk_style = player.walkstyle;
+  info.player_name = player.name;
+
+  SendBuffer buffer;
+  join_snapshot_.Update(player.player_id, SerializeToBuffer(info, buffer.Get()));
 }
 
 bool GameServer::SpawnPlayer(PlayerId player_id, std::optional<glm::vec3> position_override) {
@@ -1148,17 +1640,20 @@ bool GameServer::SpawnPlayer(PlayerId player_id, std::optional<glm::vec3> positi
   }
 
   if (position_override.has_value()) {
-    player.state.position = *position_override;
+    player_manager_.SetPosition(player.player_id, *position_override);
+    join_snapshot_.UpdatePosition(player.player_id, player.state.position);
   }
 
   const bool was_dead = player.tod != 0;
 
+  respawn_queue_.Cancel(player.player_id);
   player.flags = 0;
   player.tod = 0;
   player.health = 100;
   player.state.health_points = player.health;
 
-  player.is_ingame = 1;
+  player_manager_.SetIngame(player.player_id, true);
+  spatial_grid_.Update(player.player_id, player.state.position);
 
   PlayerSpawnPacket packet;
   packet.packet_type = PT_PLAYER_SPAWN;
@@ -1175,13 +1670,13 @@ bool GameServer::SpawnPlayer(PlayerId player_id, std::optional<glm::vec3> positi
   packet.face_texture = player.body;
   packet.walk_style = player.walkstyle;
 
-  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE, player.connection);
+  SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, player.connection, STREAM_SESSION);
 
   player_manager_.ForEachIngamePlayer([&](const Player& existing_player) {
     if (existing_player.player_id == player.player_id) {
       return;
     }
-    SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE, existing_player.connection);
+    SerializeAndSend(packet, IMMEDIATE_PRIORITY, RELIABLE_ORDERED, existing_player.connection, STREAM_SESSION);
   });
 
   SendDiscordActivity(player.connection);
@@ -28,6 +28,7 @@ SOFTWARE.
 
 #include <string.h>
 
+#include <array>
 #include <atomic>
 #include <ctime>
 #include <filesystem>
@@ -48,13 +49,32 @@ struct Response;
 }  // namespace httplib
 
 #include "Script.h"
+#include "area_events.h"
 #include "ban_manager.h"
 #include "client_resource_packager.h"
 #include "common_structs.h"
 #include "config.h"
+#include "fixed_timestep.h"
+#include "join_snapshot.h"
+#include "outbound_batcher.h"
+#include "outbound_queue.h"
+#include "packet_template.h"
+#include "player_history.h"
 #include "player_manager.h"
+#include "replication_baselines.h"
+#include "replication_lod.h"
+#include "replication_scheduler.h"
+#include "respawn_queue.h"
 #include "resource_manager.h"
 #include "resource_server.h"
+#include "resumable_sessions.h"
+#include "snapshot_writer.h"
+#include "spatial_grid.h"
+#include "state_change_tracker.h"
+#include "state_encode_cache.h"
+#include "tick_profiler.h"
+#include "tick_rate_controller.h"
+#include "worker_pool.h"
 #include "znet_server.h"
 
 #define DEFAULT_ADMIN_PORT 0x404
@@ -111,6 +131,20 @@ public:
 
   std::uint32_t GetPort() const;
 
+  /**
+   * @brief Asks the main loop to log the timing of its phases since the last periodic report, safe to call from any thread
+   */
+  void RequestTickProfileDump() {
+    tick_profile_dump_requested_.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @brief Replication ticks per second the server currently runs at
+   */
+  double GetReplicationTickRate() const {
+    return tick_rate_controller_.GetRate();
+  }
+
 private:
   void DeleteFromPlayerList(PlayerId player_id);
   void HandleCastSpell(Packet p, bool target);
@@ -120,7 +154,12 @@ private:
   void SomeoneJoinGame(Packet p);
   void HandlePlayerUpdate(Packet p);
   void MakeHPDiff(Packet p);
+  bool IsPlausibleHit(const Player& attacker, const Player& victim) const;
   void HandlePlayerDisconnect(Net::ConnectionHandle connection);
+  // Keeps the player of a lost connection around for the grace period, returns false if it has to be removed.
+  bool TrySuspendSession(Net::ConnectionHandle connection);
+  void HandleResumeSession(Packet p);
+  void ExpireSuspendedSessions();
   void HandlePlayerDeath(Player& victim, std::optional<PlayerId> killer_id);
   void HandleNormalMsg(Packet p);
   void HandleWhisp(Packet p);
@@ -128,12 +167,36 @@ private:
   void HandleGameInfo(Packet p);
   void HandleMapNameReq(Packet p);
   void SendDisconnectionInfo(PlayerId player_id);
-  void SendDeathInfo(PlayerId player_id);
-  void SendRespawnInfo(PlayerId player_id);
+  void SendDeathInfo(const Player& dead_player);
+  void SendRespawnInfo(const Player& respawned_player);
   void BroadcastPlayerJoined(const Player& joining_player);
   void SendGameInfo(Net::ConnectionHandle connection);
   void SendDiscordActivity(Net::ConnectionHandle connection);
   void SendExistingPlayersPacket(const Player& target_player);
+  void UpdateJoinSnapshot(const Player& player);
+  // Returns the number of bytes queued for the recipients.
+  std::size_t ReplicatePlayerStates();
+  void LogTickStats();
+
+  // Kinds of events that are only broadcast to the players around them, each with its own radius.
+  enum class AreaEvent : std::uint8_t { kItem, kSpell, kDeath, kCount };
+
+  /**
+   * @brief Stages the packet for the players within the event's radius of `origin`, serializing it only once
+   * @param target_player_id Player the event is aimed at, it gets the packet even when outside of the radius
+   */
+  template <typename Packet>
+  void BroadcastToArea(const Packet& packet, AreaEvent event, const glm::vec3& origin, Net::PacketPriority priority,
+                       Net::PacketReliability reliability, std::uint32_t channel, std::optional<PlayerId> excluded_player_id,
+                       std::optional<PlayerId> target_player_id);
+
+  std::array<float, static_cast<std::size_t>(AreaEvent::kCount)> area_event_radii_{};
+
+  // Small reliable messages (chat, events, server messages) are staged here and go out
+  // coalesced per connection at the end of every loop.
+  OutboundBatcher outbound_batcher_;
+  void FlushOutboundBatches();
+  void AdaptTickRate(const TickRateController::Sample& sample);
 
   std::unique_ptr<BanManager> ban_manager_;
   std::unique_ptr<LuaScript> lua_script_;
@@ -142,22 +205,91 @@ private:
   time_t regen_time;
 
   void ProcessRespawns();
+  RespawnQueue respawn_queue_;
+  // Delay between death and respawn, respawning is left to scripts if not set.
+  std::optional<std::chrono::milliseconds> respawn_delay_;
+
+  // Existing players are streamed to joiners a few chunks per simulation tick.
+  JoinSnapshot join_snapshot_;
+  std::size_t join_chunks_per_tick_{4};
+
+  // Players whose connection dropped are kept for a while, so a client reconnecting after a short
+  // outage takes its player over again and only gets what changed, instead of joining from scratch.
+  ResumableSessions resumable_sessions_;
 
   unsigned char GetPacketIdentifier(const Packet& p);
   int serverPort;
   unsigned short maxConnections;
   PlayerManager player_manager_;
+  SpatialGrid spatial_grid_;
   bool allow_modification = false;
   Config config_;
   std::unique_ptr<GothicClock> clock_;
   std::future<void> public_list_http_thread_future_;
-  std::chrono::time_point<std::chrono::steady_clock> last_update_time_{};
+  // Drives the main loop, the replication tick runs on its own schedule, which tick_rate_controller_
+  // moves between tick_rate_min_ms and tick_rate_max_ms.
+  FixedTimestep simulation_timestep_;
+  FixedTimestep replication_timestep_;
+  TickRateController tick_rate_controller_;
+  // Rate last reported in the log, changes are only logged once they are large enough to matter.
+  double logged_tick_rate_{0.0};
+  FixedTimestep::TimePoint next_tick_stats_log_{};
+  // Stream totals at the last report, the report prints what was sent since then.
+  std::array<Net::StreamStats, Net::kStreamCount> logged_stream_stats_{};
+  TickProfiler tick_profiler_;
+  std::atomic<bool> tick_profile_dump_requested_{false};
   std::thread main_thread;
   std::atomic<bool> main_thread_running = false;
   DiscordActivityState discord_activity_{};
-  bool discord_activity_initialized_{false};
+  // Encoded once per update and sent as is to every joiner, empty until scripts set an activity.
+  std::vector<std::uint8_t> discord_activity_payload_;
   std::vector<ClientResourceDescriptor> client_resource_descriptors_;
 
+  // Handshake data only changes with the config and the client resources, connections just get
+  // their player ID and resource token encoded into the cached bytes.
+  void SendInitialInfo(Net::ConnectionHandle connection, PlayerId player_id);
+  void BuildInitialInfoTemplate();
+  PacketTemplate initial_info_template_;
+  std::uint8_t game_info_flags_{0};
+
+  // Copy of a player taken at the start of a replication tick. The workers only read these copies,
+  // `player` itself is dereferenced on the main thread alone.
+  struct ReplicatedPlayer {
+    const Player* player;
+    PlayerId player_id;
+    Net::ConnectionHandle connection;
+    glm::vec3 position;
+    SpatialGrid::Cell cell;
+    // Number of PlayerState fields that differ from the player's keyframe
+    std::uint32_t changed_field_count;
+    // Revision of the player's state, see StateChangeTracker
+    std::uint32_t revision;
+  };
+  // State owned by a single replication worker, which handles the recipients with
+  // `player_id % worker count == worker index`.
+  struct ReplicationWorker {
+    explicit ReplicationWorker(std::uint32_t budget_bytes);
+
+    ReplicationScheduler scheduler;
+    SnapshotWriter snapshot_writer;
+    OutboundQueue outbound;
+  };
+  void ReplicateToRecipient(const ReplicatedPlayer& recipient, ReplicationWorker& worker, std::uint64_t tick, std::int32_t relevance_ring);
+
+  // Scratch list reused by every replication tick.
+  std::vector<ReplicatedPlayer> replicated_players_;
+  std::unordered_map<PlayerId, std::size_t> replicated_index_;
+  ReplicationLod replication_lod_;
+  ReplicationBaselines replication_baselines_;
+  StateChangeTracker state_change_tracker_;
+  // Past player states for validating hits against what the attacker saw.
+  PlayerHistory player_history_;
+  float hit_max_range_{0.0f};
+  std::uint64_t replication_tick_{0};
+  StateEncodeCache encode_cache_;
+  std::vector<std::unique_ptr<ReplicationWorker>> replication_workers_;
+  std::unique_ptr<WorkerPool> replication_pool_;
+
   std::unique_ptr<ResourceServer> resource_server_;
 };
 
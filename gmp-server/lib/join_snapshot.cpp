@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "join_snapshot.h"
+
+void JoinSnapshot::Update(PlayerId player_id, std::span<const std::uint8_t> entry) {
+  entries_[player_id].assign(entry.begin(), entry.end());
+}
+
+bool JoinSnapshot::UpdatePosition(PlayerId player_id, const glm::vec3& position) {
+  auto it = entries_.find(player_id);
+  if (it == entries_.end() || it->second.size() < kPositionOffset + 3 * sizeof(float)) {
+    return false;
+  }
+
+  const float coordinates[3] = {position.x, position.y, position.z};
+  std::memcpy(it->second.data() + kPositionOffset, coordinates, sizeof(coordinates));
+  return true;
+}
+
+void JoinSnapshot::Remove(PlayerId player_id) {
+  entries_.erase(player_id);
+}
+
+void JoinSnapshot::StartStream(Net::ConnectionHandle connection, PlayerId recipient_id) {
+  CancelStream(connection);
+
+  Stream stream{connection, {}, 0};
+  stream.player_ids.reserve(entries_.size());
+  for (const auto& [player_id, entry] : entries_) {
+    if (player_id != recipient_id) {
+      stream.player_ids.push_back(player_id);
+    }
+  }
+  if (!stream.player_ids.empty()) {
+    streams_.push_back(std::move(stream));
+  }
+}
+
+void JoinSnapshot::StartStream(Net::ConnectionHandle connection, std::vector<PlayerId> player_ids) {
+  CancelStream(connection);
+
+  if (!player_ids.empty()) {
+    streams_.push_back(Stream{connection, std::move(player_ids), 0});
+  }
+}
+
+void JoinSnapshot::CancelStream(Net::ConnectionHandle connection) {
+  std::erase_if(streams_, [connection](const Stream& stream) { return stream.connection == connection; });
+}
+
+bool JoinSnapshot::BuildChunk(Stream& stream) {
+  chunk_.clear();
+  chunk_.push_back(static_cast<std::uint8_t>(Net::PT_EXISTING_PLAYERS));
+  chunk_.push_back(0);
+
+  std::size_t count = 0;
+  while (stream.next < stream.player_ids.size() && count < kMaxChunkEntries) {
+    auto it = entries_.find(stream.player_ids[stream.next]);
+    if (it == entries_.end()) {
+      // Left after the stream started.
+      ++stream.next;
+      continue;
+    }
+    const auto& entry = it->second;
+    if (count > 0 && chunk_.size() + entry.size() > max_chunk_size_) {
+      break;
+    }
+    chunk_.insert(chunk_.end(), entry.begin(), entry.end());
+    ++count;
+    ++stream.next;
+  }
+
+  chunk_[1] = static_cast<std::uint8_t>(count);
+  return count > 0;
+}
@@ -0,0 +1,150 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <glm/glm.hpp>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "net_enums.h"
+#include "znet_server.h"
+
+/**
+ * @brief Pre-serialized ExistingPlayerInfo of every joined player, streamed to joiners in small chunks.
+ *
+ * Entries are serialized when a player joins or changes equipment, and dropped
+ * when they leave, so a join only copies bytes. Positions change too often to
+ * re-serialize, they are patched into the stored entry instead.
+ *
+ * Each joiner gets a stream of PT_EXISTING_PLAYERS chunks. A chunk is the
+ * packet type, the entry count and the entries, which is how bitsery encodes an
+ * ExistingPlayersPacket as long as the count stays below 128 and fits its
+ * single byte size prefix. Players that leave while a stream is running are
+ * skipped, players that join meanwhile get announced through PT_JOIN_GAME.
+ */
+class JoinSnapshot {
+public:
+  using PlayerId = std::uint32_t;
+
+  static constexpr std::size_t kChunkHeaderSize = 2;
+  // Counts from 128 on take two bytes in bitsery's size encoding.
+  static constexpr std::size_t kMaxChunkEntries = 127;
+  static constexpr std::size_t kDefaultMaxChunkSize = 1200;
+
+  /**
+   * @param max_chunk_size Size a chunk may grow to, a single larger entry still gets a chunk of its own
+   */
+  explicit JoinSnapshot(std::size_t max_chunk_size = kDefaultMaxChunkSize) : max_chunk_size_(max_chunk_size) {
+  }
+
+  /**
+   * @brief Stores the serialized ExistingPlayerInfo of the player, replacing the previous one
+   */
+  void Update(PlayerId player_id, std::span<const std::uint8_t> entry);
+
+  /**
+   * @brief Overwrites the position stored in the player's entry
+   * @return false if the player has no entry
+   */
+  bool UpdatePosition(PlayerId player_id, const glm::vec3& position);
+
+  void Remove(PlayerId player_id);
+
+  bool Contains(PlayerId player_id) const {
+    return entries_.contains(player_id);
+  }
+
+  /**
+   * @brief Queues a stream of every current entry except the recipient's own
+   */
+  void StartStream(Net::ConnectionHandle connection, PlayerId recipient_id);
+
+  /**
+   * @brief Queues a stream of the entries of the given players only, e.g. the ones a resumed client missed
+   */
+  void StartStream(Net::ConnectionHandle connection, std::vector<PlayerId> player_ids);
+
+  bool IsStreaming(Net::ConnectionHandle connection) const {
+    return std::any_of(streams_.begin(), streams_.end(), [connection](const Stream& stream) { return stream.connection == connection; });
+  }
+
+  /**
+   * @brief Drops the connection's stream, if it still has one
+   */
+  void CancelStream(Net::ConnectionHandle connection);
+
+  /**
+   * @brief Sends up to `max_chunks` chunks, one per stream in turn so a single joiner cannot starve the others
+   * @param send Function called as send(connection, std::span<const std::uint8_t> chunk)
+   */
+  template <typename Send>
+  void Pump(std::size_t max_chunks, Send&& send) {
+    for (std::size_t sent = 0; sent < max_chunks && !streams_.empty(); ++sent) {
+      Stream stream = std::move(streams_.front());
+      streams_.pop_front();
+      if (BuildChunk(stream)) {
+        send(stream.connection, std::span<const std::uint8_t>(chunk_));
+      }
+      if (stream.next < stream.player_ids.size()) {
+        streams_.push_back(std::move(stream));
+      }
+    }
+  }
+
+  std::size_t GetEntryCount() const {
+    return entries_.size();
+  }
+
+  std::size_t GetStreamCount() const {
+    return streams_.size();
+  }
+
+private:
+  struct Stream {
+    Net::ConnectionHandle connection;
+    std::vector<PlayerId> player_ids;
+    // Index of the first player not sent yet
+    std::size_t next{0};
+  };
+
+  // Fills chunk_ with the next entries of the stream, returns false if none were left.
+  bool BuildChunk(Stream& stream);
+
+  // ExistingPlayerInfo serializes the position right after the 4 byte player ID, as little-endian floats.
+  static constexpr std::size_t kPositionOffset = sizeof(std::uint32_t);
+  static_assert(std::endian::native == std::endian::little, "positions are patched as raw little-endian floats");
+
+  std::size_t max_chunk_size_;
+  std::unordered_map<PlayerId, std::vector<std::uint8_t>> entries_;
+  std::deque<Stream> streams_;
+  std::vector<std::uint8_t> chunk_;
+};
@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Fixed-size log-linear histogram of durations, in the spirit of HdrHistogram.
+ *
+ * Every power-of-two range of nanoseconds is split into 16 equally sized buckets,
+ * so a reported percentile is within about 6% of the real value, from single
+ * nanoseconds up to about 18 minutes. Recording is a few integer operations on a
+ * fixed array and never allocates.
+ */
+class LatencyHistogram {
+public:
+  using Duration = std::chrono::nanoseconds;
+
+  void Record(Duration duration) {
+    const std::uint64_t value = static_cast<std::uint64_t>(std::max<Duration::rep>(0, duration.count()));
+    ++counts_[BucketIndex(value)];
+    ++count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+
+  /**
+   * @brief Gets the value below or at which the given fraction of the recorded samples lie
+   * @param quantile Fraction between 0 and 1, e.g. 0.99 for the 99th percentile
+   * @return The upper bound of the bucket holding that sample, zero if nothing was recorded
+   */
+  Duration Percentile(double quantile) const {
+    if (count_ == 0) {
+      return Duration::zero();
+    }
+    const auto target =
+        std::clamp<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(count_))), 1, count_);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+      seen += counts_[i];
+      if (seen >= target) {
+        return Duration(static_cast<Duration::rep>(std::clamp(BucketUpperBound(i), min_, max_)));
+      }
+    }
+    return Max();
+  }
+
+  Duration Min() const {
+    return count_ > 0 ? Duration(static_cast<Duration::rep>(min_)) : Duration::zero();
+  }
+
+  Duration Max() const {
+    return Duration(static_cast<Duration::rep>(max_));
+  }
+
+  std::uint64_t GetCount() const {
+    return count_;
+  }
+
+  void Reset() {
+    counts_.fill(0);
+    count_ = 0;
+    min_ = std::numeric_limits<std::uint64_t>::max();
+    max_ = 0;
+  }
+
+private:
+  static constexpr std::uint32_t kSubBucketBits = 5;
+  static constexpr std::uint64_t kSubBucketCount = std::uint64_t{1} << (kSubBucketBits - 1);
+  // Values need at most this many bits, larger ones land in the last bucket.
+  static constexpr std::uint32_t kValueBits = 40;
+  static constexpr std::uint64_t kMaxValue = (std::uint64_t{1} << kValueBits) - 1;
+  static constexpr std::size_t kBucketCount = (kValueBits - kSubBucketBits + 2) * kSubBucketCount;
+
+  // Values below 2 * kSubBucketCount get a bucket each. Above that, the value's top kSubBucketBits bits
+  // select one of kSubBucketCount buckets within its power-of-two range.
+  static std::size_t BucketIndex(std::uint64_t value) {
+    value = std::min(value, kMaxValue);
+    const std::uint32_t shift = static_cast<std::uint32_t>(std::max<int>(0, std::bit_width(value) - static_cast<int>(kSubBucketBits)));
+    return static_cast<std::size_t>(shift * kSubBucketCount + (value >> shift));
+  }
+
+  static std::uint64_t BucketUpperBound(std::size_t index) {
+    if (index < 2 * kSubBucketCount) {
+      return index;
+    }
+    const std::uint64_t shift = index / kSubBucketCount - 1;
+    const std::uint64_t top = index % kSubBucketCount + kSubBucketCount;
+    return ((top + 1) << shift) - 1;
+  }
+
+  std::array<std::uint64_t, kBucketCount> counts_{};
+  std::uint64_t count_{0};
+  std::uint64_t min_{std::numeric_limits<std::uint64_t>::max()};
+  std::uint64_t max_{0};
+};
@@ -0,0 +1,87 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "outbound_batcher.h"
+
+#include <algorithm>
+
+void OutboundBatcher::Stage(Net::ConnectionHandle connection, Net::PacketPriority priority, Net::PacketReliability reliability,
+                            std::uint32_t channel, std::span<const std::uint8_t> message) {
+  if (message.empty()) {
+    return;
+  }
+
+  const Key key{connection, reliability, channel};
+  OpenBatch& open_batch = open_batches_[key];
+
+  if (message.size() > Net::kMaxBatchedMessageSize) {
+    // Cannot be framed, but still has to go out after what was staged before it.
+    open_batch.generation = 0;
+    Batch& batch = StartBatch(key, priority);
+    batch.bytes.assign(message.begin(), message.end());
+    batch.message_count = 1;
+    batch.raw = true;
+    return;
+  }
+
+  const std::size_t framed_size = Net::kBatchEntryHeaderSize + message.size();
+  if (!IsOpen(open_batch) || batches_[open_batch.index].bytes.size() + framed_size > max_batch_size_) {
+    StartBatch(key, priority);
+    open_batch = OpenBatch{batches_.size() - 1, generation_};
+  }
+
+  Batch& batch = batches_[open_batch.index];
+  Net::AppendToBatch(batch.bytes, message);
+  ++batch.message_count;
+  batch.priority = std::min(batch.priority, priority);
+}
+
+void OutboundBatcher::RemoveConnection(Net::ConnectionHandle connection) {
+  for (auto& batch : batches_) {
+    if (batch.key.connection == connection) {
+      batch.message_count = 0;
+    }
+  }
+  std::erase_if(open_batches_, [connection](const auto& entry) { return entry.first.connection == connection; });
+}
+
+void OutboundBatcher::Clear() {
+  for (auto& batch : batches_) {
+    batch.bytes.clear();
+    spare_buffers_.push_back(std::move(batch.bytes));
+  }
+  batches_.clear();
+  ++generation_;
+}
+
+OutboundBatcher::Batch& OutboundBatcher::StartBatch(const Key& key, Net::PacketPriority priority) {
+  Batch& batch = batches_.emplace_back();
+  batch.key = key;
+  batch.priority = priority;
+  if (!spare_buffers_.empty()) {
+    batch.bytes = std::move(spare_buffers_.back());
+    spare_buffers_.pop_back();
+  }
+  return batch;
+}
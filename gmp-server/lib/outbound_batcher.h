@@ -0,0 +1,135 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "message_batch.h"
+#include "znet_server.h"
+
+/**
+ * @brief Per-connection staging of small messages, sent as PT_BATCH containers once per loop.
+ *
+ * Messages staged for the same connection, reliability and channel are appended
+ * to a common batch in the order they were staged, so ordered channels stay in
+ * order. A batch goes out with the highest priority of its messages. Batches
+ * holding a single message are sent as that message, without the container.
+ * Only meant for small messages, large ones should be sent directly.
+ */
+class OutboundBatcher {
+public:
+  static constexpr std::size_t kDefaultMaxBatchSize = 1200;
+
+  /**
+   * @param max_batch_size Size a batch may grow to before a new one is started, a single larger message still gets a batch of its own
+   */
+  explicit OutboundBatcher(std::size_t max_batch_size = kDefaultMaxBatchSize) : max_batch_size_(max_batch_size) {
+  }
+
+  /**
+   * @brief Copies the message into the connection's batch for the given reliability and channel
+   */
+  void Stage(Net::ConnectionHandle connection, Net::PacketPriority priority, Net::PacketReliability reliability, std::uint32_t channel,
+             std::span<const std::uint8_t> message);
+
+  /**
+   * @brief Sends every staged batch in the order they were started
+   * @param send Function called as send(connection, priority, reliability, channel, std::span<const std::uint8_t> payload)
+   */
+  template <typename Send>
+  void Flush(Send&& send) {
+    for (auto& batch : batches_) {
+      if (batch.message_count == 0) {
+        continue;
+      }
+      std::span<const std::uint8_t> payload(batch.bytes);
+      if (batch.message_count == 1 && !batch.raw) {
+        payload = payload.subspan(Net::kBatchHeaderSize + Net::kBatchEntryHeaderSize);
+      }
+      send(batch.key.connection, batch.priority, batch.key.reliability, batch.key.channel, payload);
+    }
+    Clear();
+  }
+
+  /**
+   * @brief Drops everything staged for the connection
+   */
+  void RemoveConnection(Net::ConnectionHandle connection);
+
+  void Clear();
+
+  std::size_t GetBatchCount() const {
+    return batches_.size();
+  }
+
+private:
+  struct Key {
+    Net::ConnectionHandle connection;
+    Net::PacketReliability reliability;
+    std::uint32_t channel;
+
+    bool operator==(const Key& other) const = default;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      return std::hash<std::uint64_t>()(key.connection) ^ (static_cast<std::size_t>(key.channel) << 2) ^ static_cast<std::size_t>(key.reliability);
+    }
+  };
+
+  struct Batch {
+    Key key;
+    Net::PacketPriority priority;
+    std::vector<std::uint8_t> bytes;
+    std::size_t message_count{0};
+    // Holds a single message too large to be framed in a batch
+    bool raw{false};
+  };
+
+  struct OpenBatch {
+    // Index into batches_
+    std::size_t index{0};
+    std::uint64_t generation{0};
+  };
+
+  bool IsOpen(const OpenBatch& open_batch) const {
+    return open_batch.generation == generation_;
+  }
+
+  Batch& StartBatch(const Key& key, Net::PacketPriority priority);
+
+  std::size_t max_batch_size_;
+  // Batches in the order they were started, sealed ones included.
+  std::vector<Batch> batches_;
+  // Flushes done so far, open batches of earlier flushes are stale.
+  std::uint64_t generation_{1};
+  // Batches still accepting messages. Entries outlive a flush so the map does not reallocate its nodes every loop.
+  std::unordered_map<Key, OpenBatch, KeyHash> open_batches_;
+  // Byte buffers of flushed batches, reused so staging does not allocate once warmed up
+  std::vector<std::vector<std::uint8_t>> spare_buffers_;
+};
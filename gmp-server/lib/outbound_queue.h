@@ -0,0 +1,80 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "znet_server.h"
+
+/**
+ * @brief Messages produced off the main thread, kept until they can be handed to the network layer.
+ *
+ * Payloads are copied into a single byte buffer that keeps its capacity between
+ * drains, so queueing does not allocate once the queue has warmed up.
+ */
+class OutboundQueue {
+public:
+  void Push(Net::ConnectionHandle connection, std::span<const std::uint8_t> payload) {
+    messages_.push_back(Message{connection, bytes_.size(), payload.size()});
+    bytes_.insert(bytes_.end(), payload.begin(), payload.end());
+  }
+
+  /**
+   * @brief Passes every queued message to `send` in the order they were pushed, then empties the queue
+   * @param send Function to call for each message (receives the connection and the payload)
+   */
+  template <typename Send>
+  void Drain(Send&& send) {
+    for (const auto& message : messages_) {
+      send(message.connection, std::span<const std::uint8_t>(bytes_.data() + message.offset, message.size));
+    }
+    Clear();
+  }
+
+  void Clear() {
+    messages_.clear();
+    bytes_.clear();
+  }
+
+  std::size_t GetMessageCount() const {
+    return messages_.size();
+  }
+
+  std::size_t GetByteCount() const {
+    return bytes_.size();
+  }
+
+private:
+  struct Message {
+    Net::ConnectionHandle connection;
+    std::size_t offset;
+    std::size_t size;
+  };
+
+  std::vector<std::uint8_t> bytes_;
+  std::vector<Message> messages_;
+};
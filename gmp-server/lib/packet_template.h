@@ -0,0 +1,84 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Pre-encoded packet with a gap for the fields that differ between recipients.
+ *
+ * The head and tail are encoded once, sending the packet only copies them
+ * around the recipient's own fields, which the caller encodes into the middle.
+ */
+class PacketTemplate {
+public:
+  void Set(std::span<const std::uint8_t> head, std::span<const std::uint8_t> tail) {
+    head_.assign(head.begin(), head.end());
+    tail_.assign(tail.begin(), tail.end());
+    valid_ = true;
+  }
+
+  /**
+   * @brief Marks the template stale, it has to be Set() again before it is used
+   */
+  void Invalidate() {
+    valid_ = false;
+  }
+
+  bool IsValid() const {
+    return valid_;
+  }
+
+  /**
+   * @brief Writes head, middle and tail into `out`
+   * @param out Buffer to write to, it only grows so a reused buffer does not reallocate
+   * @return The assembled packet, a view into `out`
+   */
+  std::span<const std::uint8_t> Assemble(std::span<const std::uint8_t> middle, std::vector<std::uint8_t>& out) const {
+    const std::size_t size = head_.size() + middle.size() + tail_.size();
+    if (out.size() < size) {
+      out.resize(size);
+    }
+    std::uint8_t* data = out.data();
+    if (!head_.empty()) {
+      std::memcpy(data, head_.data(), head_.size());
+    }
+    if (!middle.empty()) {
+      std::memcpy(data + head_.size(), middle.data(), middle.size());
+    }
+    if (!tail_.empty()) {
+      std::memcpy(data + head_.size() + middle.size(), tail_.data(), tail_.size());
+    }
+    return std::span<const std::uint8_t>(out.data(), size);
+  }
+
+private:
+  std::vector<std::uint8_t> head_;
+  std::vector<std::uint8_t> tail_;
+  bool valid_{false};
+};
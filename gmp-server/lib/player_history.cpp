@@ -0,0 +1,129 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "player_history.h"
+
+#include <algorithm>
+
+PlayerHistory::PlayerHistory(std::size_t frame_count, std::size_t max_players)
+    : max_players_(max_players), frames_(std::max<std::size_t>(2, frame_count)), entries_(frames_.size() * max_players) {
+}
+
+void PlayerHistory::BeginFrame(std::uint64_t tick, TimePoint time) {
+  Frame& frame = frames_[tick % frames_.size()];
+  frame.tick = tick;
+  frame.time = time;
+  frame.count = 0;
+  frame.valid = true;
+  newest_tick_ = tick;
+}
+
+bool PlayerHistory::Record(PlayerId player_id, const Sample& sample) {
+  const std::size_t frame_index = newest_tick_ % frames_.size();
+  Frame& frame = frames_[frame_index];
+  if (!frame.valid || frame.tick != newest_tick_ || frame.count == max_players_) {
+    return false;
+  }
+  entries_[frame_index * max_players_ + frame.count] = Entry{player_id, sample};
+  ++frame.count;
+  return true;
+}
+
+std::optional<PlayerHistory::Sample> PlayerHistory::Rewind(PlayerId player_id, TimePoint view_time) const {
+  // Walk back from the newest frame to the first one taken at or before the view time. `newer` ends up
+  // as the frame right after it, if any.
+  const Frame* older = nullptr;
+  const Frame* newer = nullptr;
+  for (std::size_t age = 0; age < frames_.size() && age <= newest_tick_; ++age) {
+    const Frame* frame = FrameAt(newest_tick_ - age);
+    if (frame == nullptr) {
+      break;
+    }
+    if (frame->time <= view_time) {
+      older = frame;
+      break;
+    }
+    newer = frame;
+  }
+  if (older == nullptr) {
+    // Older than the whole history, clamp to the oldest frame.
+    std::swap(older, newer);
+  }
+  if (older == nullptr) {
+    return std::nullopt;
+  }
+
+  const Sample* from = Find(*older, player_id);
+  const Sample* to = newer != nullptr ? Find(*newer, player_id) : nullptr;
+  if (from == nullptr) {
+    return to != nullptr ? std::optional<Sample>(*to) : std::nullopt;
+  }
+  if (to == nullptr) {
+    return *from;
+  }
+
+  Sample sample = *from;
+  const auto span = newer->time - older->time;
+  if (span.count() > 0) {
+    const float t = std::chrono::duration<float>(view_time - older->time) / std::chrono::duration<float>(span);
+    sample.position = from->position + (to->position - from->position) * std::clamp(t, 0.0f, 1.0f);
+  }
+  return sample;
+}
+
+PlayerHistory::HitCheck PlayerHistory::CheckHit(PlayerId attacker_id, PlayerId victim_id, TimePoint view_time, float max_range) const {
+  auto attacker = Rewind(attacker_id, view_time);
+  auto victim = Rewind(victim_id, view_time);
+  if (!attacker.has_value() || !victim.has_value()) {
+    return HitCheck::kNoHistory;
+  }
+  if (victim->health <= 0) {
+    return HitCheck::kVictimDead;
+  }
+  const glm::vec3 offset = victim->position - attacker->position;
+  if (glm::dot(offset, offset) > max_range * max_range) {
+    return HitCheck::kOutOfRange;
+  }
+  return HitCheck::kValid;
+}
+
+void PlayerHistory::Clear() {
+  for (auto& frame : frames_) {
+    frame = Frame{};
+  }
+  newest_tick_ = 0;
+}
+
+const PlayerHistory::Frame* PlayerHistory::FrameAt(std::uint64_t tick) const {
+  const Frame& frame = frames_[tick % frames_.size()];
+  return frame.valid && frame.tick == tick ? &frame : nullptr;
+}
+
+const PlayerHistory::Sample* PlayerHistory::Find(const Frame& frame, PlayerId player_id) const {
+  const std::size_t frame_index = static_cast<std::size_t>(&frame - frames_.data());
+  const Entry* begin = entries_.data() + frame_index * max_players_;
+  const Entry* end = begin + frame.count;
+  auto it = std::find_if(begin, end, [player_id](const Entry& entry) { return entry.player_id == player_id; });
+  return it != end ? &it->sample : nullptr;
+}
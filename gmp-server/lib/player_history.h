@@ -0,0 +1,130 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Ring buffer of past player states for lag-compensated hit validation.
+ *
+ * One frame is recorded per replication tick and stored at `tick % frame_count`,
+ * so the buffer covers the last `frame_count` ticks. All storage is allocated up
+ * front for `max_players` players per frame, recording a frame only copies the
+ * samples. Queries rewind to the time an attacker saw the world, interpolating
+ * the position between the two frames around that time.
+ */
+class PlayerHistory {
+public:
+  using PlayerId = std::uint32_t;
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+
+  struct Sample {
+    glm::vec3 position{0.0f};
+    std::int16_t animation{0};
+    std::int16_t health{0};
+  };
+
+  enum class HitCheck : std::uint8_t {
+    kValid,
+    // Either player is missing from the history, e.g. right after joining
+    kNoHistory,
+    kOutOfRange,
+    kVictimDead,
+  };
+
+  /**
+   * @param frame_count Number of ticks kept, at least 2
+   * @param max_players Number of players a single frame can hold, further players are not recorded
+   */
+  PlayerHistory() : PlayerHistory(2, 0) {
+  }
+  PlayerHistory(std::size_t frame_count, std::size_t max_players);
+
+  /**
+   * @brief Starts recording the frame of the given tick, replacing the oldest frame
+   * @param tick The replication tick, expected to grow by one per call
+   * @param time Time the frame was taken at
+   */
+  void BeginFrame(std::uint64_t tick, TimePoint time);
+
+  /**
+   * @brief Adds the player's sample to the frame started last
+   * @return false if the frame is full
+   */
+  bool Record(PlayerId player_id, const Sample& sample);
+
+  /**
+   * @brief Reconstructs the player's sample at the given time
+   *
+   * Times before the oldest frame are clamped to it, so the rewind window is bounded
+   * no matter how much latency the attacker claims.
+   * @return The sample if the player was recorded around that time
+   */
+  std::optional<Sample> Rewind(PlayerId player_id, TimePoint view_time) const;
+
+  /**
+   * @brief Checks whether the attacker could have hit the victim when it saw the world at `view_time`
+   * @param max_range Largest plausible distance between attacker and victim
+   */
+  HitCheck CheckHit(PlayerId attacker_id, PlayerId victim_id, TimePoint view_time, float max_range) const;
+
+  void Clear();
+
+  std::size_t GetFrameCount() const {
+    return frames_.size();
+  }
+
+  std::size_t GetMaxPlayers() const {
+    return max_players_;
+  }
+
+private:
+  struct Frame {
+    std::uint64_t tick{0};
+    TimePoint time{};
+    std::size_t count{0};
+    bool valid{false};
+  };
+
+  struct Entry {
+    PlayerId player_id;
+    Sample sample;
+  };
+
+  const Frame* FrameAt(std::uint64_t tick) const;
+  const Sample* Find(const Frame& frame, PlayerId player_id) const;
+
+  std::size_t max_players_;
+  std::vector<Frame> frames_;
+  // frame_count * max_players entries, frame i owns [i * max_players, i * max_players + count)
+  std::vector<Entry> entries_;
+  // Tick of the frame started last, Record() appends to it.
+  std::uint64_t newest_tick_{0};
+};
@@ -0,0 +1,136 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "player_index.h"
+
+#include <algorithm>
+
+std::string PlayerIndex::MakeNameKey(std::string_view name) {
+  std::string key(name);
+  std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c); });
+  return key;
+}
+
+void PlayerIndex::EraseFromSet(StringMap& sets, std::string_view key, PlayerId player_id) {
+  auto it = sets.find(key);
+  if (it == sets.end()) {
+    return;
+  }
+
+  auto& players = it->second;
+  auto player_it = std::find(players.begin(), players.end(), player_id);
+  if (player_it != players.end()) {
+    players.erase(player_it);
+  }
+  if (players.empty()) {
+    sets.erase(it);
+  }
+}
+
+void PlayerIndex::SetName(PlayerId player_id, std::string_view name) {
+  Entry& entry = entries_[player_id];
+  std::string key = MakeNameKey(name);
+  if (!entry.name_key.empty()) {
+    if (entry.name_key == key) {
+      return;
+    }
+    EraseFromSet(names_, entry.name_key, player_id);
+  }
+
+  entry.name_key = std::move(key);
+  if (!entry.name_key.empty()) {
+    names_[entry.name_key].push_back(player_id);
+  }
+}
+
+std::optional<PlayerIndex::PlayerId> PlayerIndex::FindByName(std::string_view name) const {
+  auto it = names_.find(MakeNameKey(name));
+  if (it == names_.end()) {
+    return std::nullopt;
+  }
+  return it->second.front();
+}
+
+bool PlayerIndex::AddTag(PlayerId player_id, std::string_view tag) {
+  Entry& entry = entries_[player_id];
+  if (std::find(entry.tags.begin(), entry.tags.end(), tag) != entry.tags.end()) {
+    return false;
+  }
+
+  entry.tags.emplace_back(tag);
+  auto it = tags_.find(tag);
+  if (it == tags_.end()) {
+    it = tags_.emplace(std::string(tag), std::vector<PlayerId>{}).first;
+  }
+  it->second.push_back(player_id);
+  return true;
+}
+
+bool PlayerIndex::RemoveTag(PlayerId player_id, std::string_view tag) {
+  auto entry_it = entries_.find(player_id);
+  if (entry_it == entries_.end()) {
+    return false;
+  }
+
+  auto& tags = entry_it->second.tags;
+  auto tag_it = std::find(tags.begin(), tags.end(), tag);
+  if (tag_it == tags.end()) {
+    return false;
+  }
+
+  EraseFromSet(tags_, tag, player_id);
+  tags.erase(tag_it);
+  return true;
+}
+
+bool PlayerIndex::HasTag(PlayerId player_id, std::string_view tag) const {
+  auto it = entries_.find(player_id);
+  if (it == entries_.end()) {
+    return false;
+  }
+  const auto& tags = it->second.tags;
+  return std::find(tags.begin(), tags.end(), tag) != tags.end();
+}
+
+const std::vector<PlayerIndex::PlayerId>& PlayerIndex::GetPlayersWithTag(std::string_view tag) const {
+  static const std::vector<PlayerId> kNobody;
+  auto it = tags_.find(tag);
+  return it != tags_.end() ? it->second : kNobody;
+}
+
+void PlayerIndex::RemovePlayer(PlayerId player_id) {
+  auto it = entries_.find(player_id);
+  if (it == entries_.end()) {
+    return;
+  }
+
+  Entry& entry = it->second;
+  if (!entry.name_key.empty()) {
+    EraseFromSet(names_, entry.name_key, player_id);
+  }
+  for (const auto& tag : entry.tags) {
+    EraseFromSet(tags_, tag, player_id);
+  }
+  entries_.erase(it);
+}
@@ -0,0 +1,108 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Secondary indexes over the players for lookups that would otherwise scan everyone.
+ *
+ * Keeps a case-insensitive name index and sets of players per user-defined tag
+ * (teams, roles, whatever scripts need). The owner updates it when a player joins,
+ * is renamed or leaves; lookups then cost one hash lookup, and listing a set costs
+ * its size. The in-game players are kept by PlayerManager itself, next to their
+ * hot state.
+ */
+class PlayerIndex {
+public:
+  using PlayerId = std::uint32_t;
+
+  /**
+   * @brief Sets the name the player is found by, replacing the previous one
+   */
+  void SetName(PlayerId player_id, std::string_view name);
+
+  /**
+   * @brief Finds a player by name, ignoring ASCII case
+   * @return The player that took the name first if several share it
+   */
+  std::optional<PlayerId> FindByName(std::string_view name) const;
+
+  /**
+   * @return true if the player did not have the tag yet
+   */
+  bool AddTag(PlayerId player_id, std::string_view tag);
+
+  /**
+   * @return true if the player had the tag
+   */
+  bool RemoveTag(PlayerId player_id, std::string_view tag);
+
+  bool HasTag(PlayerId player_id, std::string_view tag) const;
+
+  /**
+   * @brief Players with the tag, in no particular order
+   */
+  const std::vector<PlayerId>& GetPlayersWithTag(std::string_view tag) const;
+
+  /**
+   * @brief Drops the player from every index
+   */
+  void RemovePlayer(PlayerId player_id);
+
+  void Clear() {
+    entries_.clear();
+    names_.clear();
+    tags_.clear();
+  }
+
+private:
+  struct Entry {
+    std::string name_key;
+    std::vector<std::string> tags;
+  };
+
+  // Lets string_view lookups into the maps go without building a std::string.
+  struct StringHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view value) const {
+      return std::hash<std::string_view>{}(value);
+    }
+  };
+  using StringMap = std::unordered_map<std::string, std::vector<PlayerId>, StringHash, std::equal_to<>>;
+
+  static std::string MakeNameKey(std::string_view name);
+  static void EraseFromSet(StringMap& sets, std::string_view key, PlayerId player_id);
+
+  std::unordered_map<PlayerId, Entry> entries_;
+  StringMap names_;
+  StringMap tags_;
+};
@@ -24,8 +24,30 @@ SOFTWARE.
 
 #include "player_manager.h"
 
+#include <cassert>
+
+namespace {
+
+constexpr std::uint32_t kMaxGeneration = (1u << (32 - PlayerManager::kSlotBits)) - 1;
+
+}  // namespace
+
 PlayerManager::PlayerId PlayerManager::AddPlayer(Net::ConnectionHandle connection, const std::string& name) {
-  PlayerId player_id = next_player_id_++;
+  std::uint32_t slot_index;
+  if (!free_slots_.empty()) {
+    slot_index = free_slots_.front();
+    free_slots_.pop_front();
+  } else {
+    assert(slots_.size() < kMaxPlayers);
+    slot_index = static_cast<std::uint32_t>(slots_.size());
+    slots_.emplace_back();
+  }
+
+  // Generation 0 is never handed out, so no ID is 0.
+  Slot& slot = slots_[slot_index];
+  slot.generation = slot.generation == kMaxGeneration ? 1 : slot.generation + 1;
+  slot.index = static_cast<std::uint32_t>(players_.size());
+  const PlayerId player_id = (slot.generation << kSlotBits) | slot_index;
 
   Player player{};
   player.player_id = player_id;
@@ -46,82 +68,219 @@ PlayerManager::PlayerId PlayerManager::AddPlayer(Net::ConnectionHandle connectio
   player.mana = 0;
   player.tod = 0;
 
-  players_[player_id] = std::move(player);
-  player_to_connection_[player_id] = connection;
-  connection_to_player_[connection] = player_id;
+  players_.push_back(std::move(player));
+  connection_slots_.Insert(connection, slot_index);
+  index_.SetName(player_id, name);
 
   return player_id;
 }
 
 bool PlayerManager::RemovePlayer(PlayerId player_id) {
-  auto it = players_.find(player_id);
-  if (it == players_.end()) {
+  auto index = FindIndex(player_id);
+  if (!index) {
     return false;
   }
 
-  Net::ConnectionHandle connection = it->second.connection;
+  const std::uint32_t slot_index = GetSlot(player_id);
+  const Net::ConnectionHandle connection = players_[*index].connection;
+  if (connection_slots_.Find(connection) == slot_index) {
+    connection_slots_.Erase(connection);
+  }
+  RemoveFromIngameColumns(slot_index);
+
+  // The last player moves into the hole to keep the array dense.
+  if (*index != players_.size() - 1) {
+    players_[*index] = std::move(players_.back());
+    slots_[GetSlot(players_[*index].player_id)].index = *index;
+  }
+  players_.pop_back();
+  index_.RemovePlayer(player_id);
 
-  players_.erase(it);
-  player_to_connection_.erase(player_id);
-  connection_to_player_.erase(connection);
+  slots_[slot_index].index = kNoIndex;
+  free_slots_.push_back(slot_index);
 
   return true;
 }
 
 bool PlayerManager::RemovePlayerByConnection(Net::ConnectionHandle connection) {
-  auto it = connection_to_player_.find(connection);
-  if (it == connection_to_player_.end()) {
+  auto index = FindIndexByConnection(connection);
+  if (!index) {
     return false;
   }
 
-  PlayerId player_id = it->second;
-  return RemovePlayer(player_id);
+  return RemovePlayer(players_[*index].player_id);
 }
 
 std::optional<std::reference_wrapper<PlayerManager::Player>> PlayerManager::GetPlayer(PlayerId player_id) {
-  auto it = players_.find(player_id);
-  if (it == players_.end()) {
+  auto index = FindIndex(player_id);
+  if (!index) {
     return std::nullopt;
   }
-  return std::ref(it->second);
+  return std::ref(players_[*index]);
 }
 
 std::optional<std::reference_wrapper<const PlayerManager::Player>> PlayerManager::GetPlayer(PlayerId player_id) const {
-  auto it = players_.find(player_id);
-  if (it == players_.end()) {
+  auto index = FindIndex(player_id);
+  if (!index) {
     return std::nullopt;
   }
-  return std::cref(it->second);
+  return std::cref(players_[*index]);
+}
+bool PlayerManager::DetachConnection(PlayerId player_id) {
+  auto index = FindIndex(player_id);
+  if (!index) {
+    return false;
+  }
+
+  // Player::connection keeps the old handle until the player is attached to a new one.
+  const Net::ConnectionHandle connection = players_[*index].connection;
+  if (connection_slots_.Find(connection) == GetSlot(player_id)) {
+    connection_slots_.Erase(connection);
+  }
+  return true;
+}
+
+bool PlayerManager::AttachConnection(PlayerId player_id, Net::ConnectionHandle connection) {
+  auto index = FindIndex(player_id);
+  if (!index) {
+    return false;
+  }
+
+  DetachConnection(player_id);
+  players_[*index].connection = connection;
+  connection_slots_.Insert(connection, GetSlot(player_id));
+  return true;
+}
+
+bool PlayerManager::SetPlayerName(PlayerId player_id, const std::string& name) {
+  auto index = FindIndex(player_id);
+  if (!index) {
+    return false;
+  }
+
+  players_[*index].name = name;
+  index_.SetName(player_id, name);
+  return true;
+}
+
+bool PlayerManager::SetIngame(PlayerId player_id, bool ingame) {
+  auto index = FindIndex(player_id);
+  if (!index) {
+    return false;
+  }
+
+  Player& player = players_[*index];
+  player.is_ingame = ingame ? 1 : 0;
+  const std::uint32_t slot_index = GetSlot(player_id);
+  if (!ingame) {
+    RemoveFromIngameColumns(slot_index);
+  } else if (slots_[slot_index].ingame_index == kNoIndex) {
+    slots_[slot_index].ingame_index = static_cast<std::uint32_t>(ingame_ids_.size());
+    ingame_ids_.push_back(player_id);
+    ingame_positions_.push_back(player.state.position);
+  }
+  return true;
+}
+
+bool PlayerManager::SetState(PlayerId player_id, const PlayerState& state) {
+  auto index = FindIndex(player_id);
+  if (!index) {
+    return false;
+  }
+
+  players_[*index].state = state;
+  const std::uint32_t ingame_index = slots_[GetSlot(player_id)].ingame_index;
+  if (ingame_index != kNoIndex) {
+    ingame_positions_[ingame_index] = state.position;
+  }
+  return true;
+}
+
+bool PlayerManager::SetPosition(PlayerId player_id, const glm::vec3& position) {
+  auto index = FindIndex(player_id);
+  if (!index) {
+    return false;
+  }
+
+  players_[*index].state.position = position;
+  const std::uint32_t ingame_index = slots_[GetSlot(player_id)].ingame_index;
+  if (ingame_index != kNoIndex) {
+    ingame_positions_[ingame_index] = position;
+  }
+  return true;
+}
+
+void PlayerManager::RemoveFromIngameColumns(std::uint32_t slot_index) {
+  const std::uint32_t ingame_index = slots_[slot_index].ingame_index;
+  if (ingame_index == kNoIndex) {
+    return;
+  }
+
+  // The last in-game player takes the leaving one's place in every column.
+  if (ingame_index != ingame_ids_.size() - 1) {
+    ingame_ids_[ingame_index] = ingame_ids_.back();
+    ingame_positions_[ingame_index] = ingame_positions_.back();
+    slots_[GetSlot(ingame_ids_[ingame_index])].ingame_index = ingame_index;
+  }
+  ingame_ids_.pop_back();
+  ingame_positions_.pop_back();
+  slots_[slot_index].ingame_index = kNoIndex;
 }
 
 std::optional<std::reference_wrapper<PlayerManager::Player>> PlayerManager::GetPlayerByConnection(Net::ConnectionHandle connection) {
-  auto it = connection_to_player_.find(connection);
-  if (it == connection_to_player_.end()) {
+  auto index = FindIndexByConnection(connection);
+  if (!index) {
     return std::nullopt;
   }
-  return GetPlayer(it->second);
+  return std::ref(players_[*index]);
 }
 
 std::optional<std::reference_wrapper<const PlayerManager::Player>> PlayerManager::GetPlayerByConnection(Net::ConnectionHandle connection) const {
-  auto it = connection_to_player_.find(connection);
-  if (it == connection_to_player_.end()) {
+  auto index = FindIndexByConnection(connection);
+  if (!index) {
     return std::nullopt;
   }
-  return GetPlayer(it->second);
+  return std::cref(players_[*index]);
 }
 
 std::optional<Net::ConnectionHandle> PlayerManager::GetConnectionHandle(PlayerId player_id) const {
-  auto it = player_to_connection_.find(player_id);
-  if (it == player_to_connection_.end()) {
+  auto index = FindIndex(player_id);
+  if (!index) {
     return std::nullopt;
   }
-  return it->second;
+  return players_[*index].connection;
 }
 
 std::optional<PlayerManager::PlayerId> PlayerManager::GetPlayerId(Net::ConnectionHandle connection) const {
-  auto it = connection_to_player_.find(connection);
-  if (it == connection_to_player_.end()) {
+  auto index = FindIndexByConnection(connection);
+  if (!index) {
+    return std::nullopt;
+  }
+  return players_[*index].player_id;
+}
+
+std::optional<std::uint32_t> PlayerManager::FindIndex(PlayerId player_id) const {
+  const std::uint32_t slot_index = GetSlot(player_id);
+  if (slot_index >= slots_.size()) {
+    return std::nullopt;
+  }
+
+  const Slot& slot = slots_[slot_index];
+  if (slot.index == kNoIndex || slot.generation != GetGeneration(player_id)) {
+    return std::nullopt;
+  }
+  return slot.index;
+}
+
+std::optional<std::uint32_t> PlayerManager::FindIndexByConnection(Net::ConnectionHandle connection) const {
+  auto slot_index = connection_slots_.Find(connection);
+  if (!slot_index) {
+    return std::nullopt;
+  }
+
+  const std::uint32_t index = slots_[*slot_index].index;
+  if (index == kNoIndex) {
     return std::nullopt;
   }
-  return it->second;
+  return index;
 }
@@ -26,12 +26,18 @@ SOFTWARE.
 
 #include <cstdint>
 #include <ctime>
+#include <deque>
 #include <functional>
 #include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
+
+#include <glm/glm.hpp>
 
 #include "common_structs.h"
+#include "connection_index.h"
+#include "player_index.h"
 #include "znet_server.h"
 
 /**
@@ -39,11 +45,38 @@ SOFTWARE.
  *
  * PlayerManager maintains the mapping between network connections and game-level
  * player IDs, and handles player lifecycle (join, leave, state management).
+ *
+ * Players are stored densely in a slot map, so iterating over them walks a single
+ * contiguous array. A PlayerId holds the slot in its low kSlotBits bits and the
+ * generation of that slot in the remaining bits. The generation changes every time
+ * a slot is reused, so an ID kept around after its player left (e.g. by a script)
+ * no longer resolves instead of silently pointing at whoever took the slot over.
+ * IDs are never 0.
+ *
+ * The state the per-tick loops read for every in-game player is also kept in dense
+ * columns (IDs and positions, one entry per in-game player at the same position in
+ * each), so replication and area queries walk a few flat arrays instead of the whole
+ * Player records.
+ *
+ * Adding or removing a player may move the others in memory, references returned
+ * by GetPlayer stay valid only until the next AddPlayer/RemovePlayer call. The same
+ * goes for the columns and SetIngame.
  */
 class PlayerManager {
 public:
   using PlayerId = std::uint32_t;
 
+  static constexpr std::uint32_t kSlotBits = 20;
+  static constexpr std::uint32_t kMaxPlayers = 1u << kSlotBits;
+
+  static constexpr std::uint32_t GetSlot(PlayerId player_id) {
+    return player_id & (kMaxPlayers - 1);
+  }
+
+  static constexpr std::uint32_t GetGeneration(PlayerId player_id) {
+    return player_id >> kSlotBits;
+  }
+
   /**
    * @brief Player flags for various states
    */
@@ -55,7 +88,7 @@ public:
   struct Player {
     PlayerId player_id;
     Net::ConnectionHandle connection;
-    std::string name;
+    std::string name;  // indexed, change it through SetPlayerName
 
     // Character appearance
     std::uint8_t head;
@@ -70,7 +103,7 @@ public:
     std::uint8_t headstate;
 
     // Game state
-    std::uint8_t is_ingame;
+    std::uint8_t is_ingame;  // mirrored in the in-game columns, change it through SetIngame
     std::uint8_t passed_crc_test;
     std::uint8_t mute;
 
@@ -78,7 +111,7 @@ public:
     std::int16_t mana;
 
     std::time_t tod;  // time of death
-    PlayerState state;
+    PlayerState state;  // position is mirrored in the in-game columns, change it through SetState/SetPosition
   };
 
   PlayerManager() = default;
@@ -152,14 +185,112 @@ public:
    */
   std::optional<PlayerId> GetPlayerId(Net::ConnectionHandle connection) const;
 
+  /**
+   * @brief Unbinds the player from its connection, the player stays until it is removed or attached again
+   * @return false if the player does not exist
+   */
+  bool DetachConnection(PlayerId player_id);
+
+  /**
+   * @brief Binds the player to a new connection, e.g. when a suspended session is resumed
+   * @return false if the player does not exist
+   */
+  bool AttachConnection(PlayerId player_id, Net::ConnectionHandle connection);
+
+  /**
+   * @brief Renames the player, keeping the name index up to date
+   * @return false if the player does not exist
+   */
+  bool SetPlayerName(PlayerId player_id, const std::string& name);
+
+  /**
+   * @brief Marks the player as in game or not, adding it to or removing it from the in-game columns
+   * @return false if the player does not exist
+   */
+  bool SetIngame(PlayerId player_id, bool ingame);
+
+  /**
+   * @brief Replaces the player's state, keeping the in-game columns up to date
+   * @return false if the player does not exist
+   */
+  bool SetState(PlayerId player_id, const PlayerState& state);
+
+  /**
+   * @brief Moves the player, keeping the in-game columns up to date
+   * @return false if the player does not exist
+   */
+  bool SetPosition(PlayerId player_id, const glm::vec3& position);
+
+  /**
+   * @brief Finds a player by name, ignoring ASCII case
+   * @param name The player's name
+   * @return The player ID if found
+   */
+  std::optional<PlayerId> FindPlayerByName(std::string_view name) const {
+    return index_.FindByName(name);
+  }
+
+  /**
+   * @brief Adds a user-defined tag (e.g. a team) to the player
+   * @return true if the player exists and did not have the tag yet
+   */
+  bool AddTag(PlayerId player_id, std::string_view tag) {
+    return HasPlayer(player_id) && index_.AddTag(player_id, tag);
+  }
+
+  /**
+   * @brief Removes a user-defined tag from the player
+   * @return true if the player had the tag
+   */
+  bool RemoveTag(PlayerId player_id, std::string_view tag) {
+    return index_.RemoveTag(player_id, tag);
+  }
+
+  /**
+   * @brief Secondary indexes over the players (names, tags)
+   */
+  const PlayerIndex& GetIndex() const {
+    return index_;
+  }
+
   /**
    * @brief Gets all players
-   * @return Const reference to the players map
+   * @return Const reference to the densely stored players, in no particular order
    */
-  const std::unordered_map<PlayerId, Player>& GetAllPlayers() const {
+  const std::vector<Player>& GetAllPlayers() const {
     return players_;
   }
 
+  /**
+   * @brief IDs of the in-game players, in no particular order
+   */
+  const std::vector<PlayerId>& GetIngameIds() const {
+    return ingame_ids_;
+  }
+
+  /**
+   * @brief Positions of the in-game players, GetIngamePositions()[i] belongs to GetIngameIds()[i]
+   */
+  const std::vector<glm::vec3>& GetIngamePositions() const {
+    return ingame_positions_;
+  }
+
+  /**
+   * @brief Reads the player's position from the in-game columns
+   * @return The position, or nothing if the player does not exist or is not in game
+   */
+  std::optional<glm::vec3> GetIngamePosition(PlayerId player_id) const {
+    auto index = FindIndex(player_id);
+    if (!index) {
+      return std::nullopt;
+    }
+    const std::uint32_t ingame_index = slots_[GetSlot(player_id)].ingame_index;
+    if (ingame_index == kNoIndex) {
+      return std::nullopt;
+    }
+    return ingame_positions_[ingame_index];
+  }
+
   /**
    * @brief Gets the number of players
    * @return The player count
@@ -174,7 +305,7 @@ public:
    * @return true if the player exists, false otherwise
    */
   bool HasPlayer(PlayerId player_id) const {
-    return players_.find(player_id) != players_.end();
+    return FindIndex(player_id).has_value();
   }
 
   /**
@@ -183,7 +314,7 @@ public:
    * @return true if a player with this connection exists, false otherwise
    */
   bool HasConnection(Net::ConnectionHandle connection) const {
-    return connection_to_player_.find(connection) != connection_to_player_.end();
+    return connection_slots_.Contains(connection);
   }
 
   /**
@@ -192,7 +323,7 @@ public:
    */
   template <typename Func>
   void ForEachPlayer(Func&& func) {
-    for (auto& [id, player] : players_) {
+    for (auto& player : players_) {
       func(player);
     }
   }
@@ -203,21 +334,20 @@ public:
    */
   template <typename Func>
   void ForEachPlayer(Func&& func) const {
-    for (const auto& [id, player] : players_) {
+    for (const auto& player : players_) {
       func(player);
     }
   }
 
   /**
-   * @brief Iterates over all in-game players
-   * @param func Function to call for each in-game player (receives Player&)
+   * @brief Iterates over all in-game players, visiting only them instead of scanning every player
+   * @param func Function to call for each in-game player (receives Player&), it must not add, remove or
+   *             change the in-game state of players
    */
   template <typename Func>
   void ForEachIngamePlayer(Func&& func) {
-    for (auto& [id, player] : players_) {
-      if (player.is_ingame) {
-        func(player);
-      }
+    for (PlayerId player_id : ingame_ids_) {
+      func(players_[slots_[GetSlot(player_id)].index]);
     }
   }
 
@@ -227,10 +357,8 @@ public:
    */
   template <typename Func>
   void ForEachIngamePlayer(Func&& func) const {
-    for (const auto& [id, player] : players_) {
-      if (player.is_ingame) {
-        func(player);
-      }
+    for (PlayerId player_id : ingame_ids_) {
+      func(players_[slots_[GetSlot(player_id)].index]);
     }
   }
 
@@ -239,14 +367,38 @@ public:
    */
   void Clear() {
     players_.clear();
-    player_to_connection_.clear();
-    connection_to_player_.clear();
-    next_player_id_ = 1;
+    slots_.clear();
+    free_slots_.clear();
+    connection_slots_.Clear();
+    index_.Clear();
+    ingame_ids_.clear();
+    ingame_positions_.clear();
   }
 
 private:
-  PlayerId next_player_id_ = 1;
-  std::unordered_map<PlayerId, Player> players_;
-  std::unordered_map<PlayerId, Net::ConnectionHandle> player_to_connection_;
-  std::unordered_map<Net::ConnectionHandle, PlayerId> connection_to_player_;
+  static constexpr std::uint32_t kNoIndex = 0xFFFFFFFF;
+
+  struct Slot {
+    std::uint32_t generation{0};
+    // Position of the player in players_, kNoIndex while the slot is free
+    std::uint32_t index{kNoIndex};
+    // Position of the player in the in-game columns, kNoIndex while it is not in game
+    std::uint32_t ingame_index{kNoIndex};
+  };
+
+  std::optional<std::uint32_t> FindIndex(PlayerId player_id) const;
+  std::optional<std::uint32_t> FindIndexByConnection(Net::ConnectionHandle connection) const;
+  void RemoveFromIngameColumns(std::uint32_t slot_index);
+
+  std::vector<Player> players_;
+  std::vector<Slot> slots_;
+  // Freed slots are reused oldest first, which spreads the reuse and keeps the
+  // generations from wrapping around quickly when players reconnect over and over.
+  std::deque<std::uint32_t> free_slots_;
+  // Connection to the slot of its player, a packet's sender is found with one probe and two array reads.
+  ConnectionIndex connection_slots_;
+  PlayerIndex index_;
+  // Hot state of the in-game players, one entry per in-game player in each column.
+  std::vector<PlayerId> ingame_ids_;
+  std::vector<glm::vec3> ingame_positions_;
 };
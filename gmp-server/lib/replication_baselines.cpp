@@ -0,0 +1,87 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "replication_baselines.h"
+
+#include <algorithm>
+
+ReplicationBaselines::ReplicationBaselines(std::uint32_t keyframe_interval_ticks, std::size_t shard_count)
+    : keyframe_interval_ticks_(std::max<std::uint32_t>(1, keyframe_interval_ticks)), sent_keyframes_(std::max<std::size_t>(1, shard_count)) {
+}
+
+const ReplicationBaselines::Keyframe& ReplicationBaselines::RefreshKeyframe(PlayerId player_id, const PlayerState& state,
+                                                                            std::uint64_t tick) {
+  auto [it, inserted] = keyframes_.try_emplace(player_id);
+  Keyframe& keyframe = it->second;
+
+  if (inserted || tick - keyframe.tick >= keyframe_interval_ticks_) {
+    if (!inserted) {
+      ++keyframe.sequence;
+    }
+    keyframe.tick = tick;
+    keyframe.state = state;
+  }
+  return keyframe;
+}
+
+bool ReplicationBaselines::NeedsKeyframe(PlayerId recipient_id, PlayerId subject_id) const {
+  auto keyframe_it = keyframes_.find(subject_id);
+  if (keyframe_it == keyframes_.end()) {
+    return false;
+  }
+  const auto& shard = ShardOf(recipient_id);
+  auto recipient_it = shard.find(recipient_id);
+  if (recipient_it == shard.end()) {
+    return true;
+  }
+  auto it = recipient_it->second.find(subject_id);
+  return it == recipient_it->second.end() || it->second != keyframe_it->second.tick;
+}
+
+bool ReplicationBaselines::MarkKeyframeSent(PlayerId recipient_id, PlayerId subject_id) {
+  auto keyframe_it = keyframes_.find(subject_id);
+  if (keyframe_it == keyframes_.end()) {
+    return false;
+  }
+
+  auto [it, inserted] = ShardOf(recipient_id)[recipient_id].try_emplace(subject_id, keyframe_it->second.tick);
+  if (inserted) {
+    return true;
+  }
+  if (it->second == keyframe_it->second.tick) {
+    return false;
+  }
+  it->second = keyframe_it->second.tick;
+  return true;
+}
+
+void ReplicationBaselines::RemovePlayer(PlayerId player_id) {
+  keyframes_.erase(player_id);
+  ShardOf(player_id).erase(player_id);
+  for (auto& shard : sent_keyframes_) {
+    for (auto& [recipient_id, sent] : shard) {
+      sent.erase(player_id);
+    }
+  }
+}
@@ -0,0 +1,122 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "common_structs.h"
+
+/**
+ * @brief Keyframes used as delta baselines for player state replication.
+ *
+ * Every replicated player has a single keyframe shared by all recipients, so a
+ * delta is encoded once per tick regardless of how many players observe it. A
+ * keyframe is replaced every `keyframe_interval_ticks` ticks, which bounds both
+ * the size of the deltas and the time a recipient that lost a keyframe on the
+ * unreliable channel keeps dropping deltas.
+ *
+ * For each recipient the tracker remembers which keyframe of every observed
+ * player it has been sent, so keyframes only go to the recipients missing them.
+ * That bookkeeping is sharded by recipient: once the keyframes of a tick are
+ * refreshed, NeedsKeyframe and MarkKeyframeSent may be called concurrently for
+ * recipients that fall into different shards.
+ */
+class ReplicationBaselines {
+public:
+  using PlayerId = std::uint32_t;
+
+  struct Keyframe {
+    std::uint8_t sequence{0};
+    // Tick the keyframe was taken at, unique per player and never wraps.
+    std::uint64_t tick{0};
+    PlayerState state;
+  };
+
+  /**
+   * @param keyframe_interval_ticks Number of ticks after which a player's keyframe is replaced
+   * @param shard_count Number of recipient shards, recipient `id` belongs to shard `id % shard_count`
+   */
+  explicit ReplicationBaselines(std::uint32_t keyframe_interval_ticks, std::size_t shard_count = 1);
+
+  /**
+   * @brief Gets the player's keyframe, taking a new one from `state` if none exists or the current one expired
+   * @param player_id The replicated player
+   * @param state The player's current state
+   * @param tick The current replication tick
+   * @return The keyframe deltas of this tick must be encoded against
+   */
+  const Keyframe& RefreshKeyframe(PlayerId player_id, const PlayerState& state, std::uint64_t tick);
+
+  /**
+   * @brief Checks whether the recipient has not been sent the current keyframe of the subject yet
+   */
+  bool NeedsKeyframe(PlayerId recipient_id, PlayerId subject_id) const;
+
+  /**
+   * @brief Records that the recipient is sent the current keyframe of the subject
+   * @return true if the recipient had not been sent this keyframe before and it has to be sent now, false otherwise
+   */
+  bool MarkKeyframeSent(PlayerId recipient_id, PlayerId subject_id);
+
+  /**
+   * @brief Forgets the player, both as a replicated subject and as a recipient
+   */
+  void RemovePlayer(PlayerId player_id);
+
+  /**
+   * @brief Forgets which keyframes the recipient was sent, so it gets all of them again
+   */
+  void ForgetRecipient(PlayerId recipient_id) {
+    ShardOf(recipient_id).erase(recipient_id);
+  }
+
+  void Clear() {
+    keyframes_.clear();
+    for (auto& shard : sent_keyframes_) {
+      shard.clear();
+    }
+  }
+
+  std::size_t GetShardCount() const {
+    return sent_keyframes_.size();
+  }
+
+private:
+  using SentKeyframes = std::unordered_map<PlayerId, std::unordered_map<PlayerId, std::uint64_t>>;
+
+  SentKeyframes& ShardOf(PlayerId recipient_id) {
+    return sent_keyframes_[recipient_id % sent_keyframes_.size()];
+  }
+  const SentKeyframes& ShardOf(PlayerId recipient_id) const {
+    return sent_keyframes_[recipient_id % sent_keyframes_.size()];
+  }
+
+  std::uint32_t keyframe_interval_ticks_;
+  std::unordered_map<PlayerId, Keyframe> keyframes_;
+  // shard -> recipient -> subject -> tick of the last keyframe sent
+  std::vector<SentKeyframes> sent_keyframes_;
+};
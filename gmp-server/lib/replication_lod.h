@@ -0,0 +1,137 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+/**
+ * @brief Distance based update rate tiers for player replication.
+ *
+ * Remote players close to the recipient are replicated every tick, players further
+ * away at a reduced rate and players beyond the relevance radius only show up on
+ * the map, even less often. Every recipient/subject pair has its own phase within
+ * the interval of its tier, so the reduced rate updates are spread evenly across
+ * ticks instead of all landing on the same one.
+ */
+class ReplicationLod {
+public:
+  using PlayerId = std::uint32_t;
+
+  enum class Tier : std::uint8_t {
+    // Full state every tick
+    kNear,
+    // Full state every mid_interval_ticks
+    kMid,
+    // Map position only, every far_interval_ticks
+    kFar,
+  };
+
+  struct Settings {
+    float near_radius{1500.0f};
+    float mid_radius{5000.0f};
+    std::uint32_t mid_interval_ticks{2};
+    std::uint32_t far_interval_ticks{10};
+  };
+
+  ReplicationLod() : ReplicationLod(Settings{}) {
+  }
+
+  explicit ReplicationLod(const Settings& settings) : settings_(settings) {
+    settings_.near_radius = std::max(0.0f, settings_.near_radius);
+    settings_.mid_radius = std::max(settings_.near_radius, settings_.mid_radius);
+    settings_.mid_interval_ticks = std::max<std::uint32_t>(1, settings_.mid_interval_ticks);
+    settings_.far_interval_ticks = std::max<std::uint32_t>(1, settings_.far_interval_ticks);
+  }
+
+  /**
+   * @brief Picks the tier of a subject as seen from the recipient, by horizontal distance
+   */
+  Tier Classify(const glm::vec3& recipient_position, const glm::vec3& subject_position) const {
+    return Classify(HorizontalDistance(recipient_position, subject_position));
+  }
+
+  Tier Classify(float distance) const {
+    if (distance <= settings_.near_radius) {
+      return Tier::kNear;
+    }
+    if (distance <= settings_.mid_radius) {
+      return Tier::kMid;
+    }
+    return Tier::kFar;
+  }
+
+  // Gothic uses Y as the vertical axis, height does not matter for relevance.
+  static float HorizontalDistance(const glm::vec3& a, const glm::vec3& b) {
+    const float dx = a.x - b.x;
+    const float dz = a.z - b.z;
+    return std::sqrt(dx * dx + dz * dz);
+  }
+
+  /**
+   * @brief Checks whether the pair is scheduled for an update on the given tick
+   */
+  bool IsDue(Tier tier, PlayerId recipient_id, PlayerId subject_id, std::uint64_t tick) const {
+    const std::uint32_t interval = GetInterval(tier);
+    if (interval == 1) {
+      return true;
+    }
+    return (tick + PairPhase(recipient_id, subject_id)) % interval == 0;
+  }
+
+  std::uint32_t GetInterval(Tier tier) const {
+    switch (tier) {
+      case Tier::kNear:
+        return 1;
+      case Tier::kMid:
+        return settings_.mid_interval_ticks;
+      case Tier::kFar:
+        return settings_.far_interval_ticks;
+    }
+    return 1;
+  }
+
+  // Players further away than this only get map updates.
+  float GetRelevanceRadius() const {
+    return settings_.mid_radius;
+  }
+
+  const Settings& GetSettings() const {
+    return settings_;
+  }
+
+private:
+  static std::uint32_t PairPhase(PlayerId recipient_id, PlayerId subject_id) {
+    std::uint32_t hash = recipient_id * 0x9E3779B1u ^ subject_id * 0x85EBCA77u;
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6Du;
+    hash ^= hash >> 12;
+    return hash;
+  }
+
+  Settings settings_;
+};
@@ -0,0 +1,89 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "replication_scheduler.h"
+
+#include <algorithm>
+
+namespace {
+
+// Distance at which the distance part of the weight drops to a half.
+constexpr float kDistanceFalloff = 1000.0f;
+constexpr float kChangedFieldWeight = 0.25f;
+
+}  // namespace
+
+ReplicationScheduler::ReplicationScheduler(std::uint32_t budget_bytes) : budget_bytes_(budget_bytes) {
+}
+
+void ReplicationScheduler::BeginRecipient(PlayerId recipient_id) {
+  candidates_.clear();
+  current_pairs_ = &pairs_[recipient_id];
+}
+
+bool ReplicationScheduler::IsCarriedOver(PlayerId subject_id) const {
+  auto it = current_pairs_->find(subject_id);
+  return it != current_pairs_->end() && it->second.carried_over;
+}
+
+bool ReplicationScheduler::IsUpToDate(PlayerId subject_id, Payload payload, std::uint32_t revision) const {
+  auto it = current_pairs_->find(subject_id);
+  if (it == current_pairs_->end()) {
+    return false;
+  }
+  const PairState& pair = it->second;
+  return (payload == Payload::kState ? pair.state_revision : pair.map_revision) == revision;
+}
+
+void ReplicationScheduler::AddCandidate(PlayerId subject_id, Payload payload, std::uint32_t size, float weight, std::uint32_t revision) {
+  PairState& pair = (*current_pairs_)[subject_id];
+  pair.priority += weight;
+  candidates_.push_back(Candidate{subject_id, payload, size, pair.priority, revision, &pair});
+}
+
+void ReplicationScheduler::RemovePlayer(PlayerId player_id) {
+  // Pending candidates may point into the erased pairs.
+  candidates_.clear();
+  current_pairs_ = nullptr;
+  pairs_.erase(player_id);
+  for (auto& [recipient_id, pairs] : pairs_) {
+    pairs.erase(player_id);
+  }
+}
+
+float ReplicationScheduler::StateWeight(float distance, std::uint32_t changed_field_count) {
+  return 1.0f / (1.0f + std::max(0.0f, distance) / kDistanceFalloff) + kChangedFieldWeight * static_cast<float>(changed_field_count);
+}
+
+void ReplicationScheduler::SortCandidates() {
+  if (budget_bytes_ == 0) {
+    return;
+  }
+  std::sort(candidates_.begin(), candidates_.end(), [](const Candidate& a, const Candidate& b) {
+    if (a.priority != b.priority) {
+      return a.priority > b.priority;
+    }
+    return a.subject_id < b.subject_id;
+  });
+}
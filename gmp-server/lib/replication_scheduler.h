@@ -0,0 +1,162 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Priority accumulator deciding which replication entries fit a connection's per-tick byte budget.
+ *
+ * Every tick each candidate (recipient, subject) pair adds a weight derived from
+ * distance and state change onto its accumulated priority. The highest priority
+ * candidates that fit the budget are sent and their priority is reset, the rest
+ * keep their priority and are carried over to the next tick, so a pair that keeps
+ * losing grows more important until it wins. Staleness is thereby accounted for
+ * by the accumulation itself.
+ *
+ * Usage per recipient and tick: BeginRecipient(), AddCandidate() for each entry,
+ * then SendSelected().
+ */
+class ReplicationScheduler {
+public:
+  using PlayerId = std::uint32_t;
+
+  enum class Payload : std::uint8_t { kState, kMapOnly };
+
+  /**
+   * @param budget_bytes Bytes each connection may be sent per tick, 0 disables the limit
+   */
+  explicit ReplicationScheduler(std::uint32_t budget_bytes = 0);
+
+  void SetBudget(std::uint32_t budget_bytes) {
+    budget_bytes_ = budget_bytes;
+  }
+
+  std::uint32_t GetBudget() const {
+    return budget_bytes_;
+  }
+
+  /**
+   * @brief Starts collecting the candidates of the recipient, dropping those of the previous one
+   */
+  void BeginRecipient(PlayerId recipient_id);
+
+  /**
+   * @brief Checks whether the subject lost out on the budget on an earlier tick and is still waiting
+   */
+  bool IsCarriedOver(PlayerId subject_id) const;
+
+  /**
+   * @brief Checks whether the recipient was already sent this revision of the subject's payload
+   * @param revision Revision of the subject, see StateChangeTracker
+   */
+  bool IsUpToDate(PlayerId subject_id, Payload payload, std::uint32_t revision) const;
+
+  /**
+   * @brief Adds the weight onto the pair's accumulated priority and makes it a candidate for this tick
+   * @param subject_id The replicated player
+   * @param payload What would be sent about the subject
+   * @param size Encoded size of the entry in bytes
+   * @param weight Priority gained this tick, see StateWeight() and kMapOnlyWeight
+   * @param revision Revision of the subject the entry was encoded from, recorded for IsUpToDate() once sent
+   */
+  void AddCandidate(PlayerId subject_id, Payload payload, std::uint32_t size, float weight, std::uint32_t revision = 0);
+
+  /**
+   * @brief Sends the highest priority candidates that fit the budget, carrying the others over
+   * @param send Function called as send(PlayerId subject_id, Payload payload) for each selected candidate
+   * @return Number of bytes selected
+   */
+  template <typename Send>
+  std::uint32_t SendSelected(Send&& send) {
+    SortCandidates();
+
+    std::uint32_t used_bytes = 0;
+    for (const auto& candidate : candidates_) {
+      // The top candidate always goes out, so an entry larger than the budget cannot starve.
+      const bool fits = budget_bytes_ == 0 || used_bytes == 0 || used_bytes + candidate.size <= budget_bytes_;
+      if (fits) {
+        send(candidate.subject_id, candidate.payload);
+        used_bytes += candidate.size;
+        candidate.pair->priority = 0.0f;
+        candidate.pair->carried_over = false;
+        candidate.pair->SentRevision(candidate.payload) = candidate.revision;
+      } else {
+        candidate.pair->carried_over = true;
+      }
+    }
+    candidates_.clear();
+    return used_bytes;
+  }
+
+  /**
+   * @brief Forgets the player, both as a recipient and as a subject
+   */
+  void RemovePlayer(PlayerId player_id);
+
+  /**
+   * @brief Weight of a full state entry: closer players and players whose state differs more from their
+   * keyframe matter more
+   * @param distance Horizontal distance between recipient and subject
+   * @param changed_field_count Number of PlayerState fields that differ from the subject's keyframe
+   */
+  static float StateWeight(float distance, std::uint32_t changed_field_count);
+
+  // Map positions are a nicety compared to the state of players around the recipient.
+  static constexpr float kMapOnlyWeight = 0.05f;
+
+private:
+  struct PairState {
+    float priority{0.0f};
+    bool carried_over{false};
+    // Revisions of the subject last sent to the recipient, 0 if none was sent yet.
+    std::uint32_t state_revision{0};
+    std::uint32_t map_revision{0};
+
+    std::uint32_t& SentRevision(Payload payload) {
+      return payload == Payload::kState ? state_revision : map_revision;
+    }
+  };
+
+  struct Candidate {
+    PlayerId subject_id;
+    Payload payload;
+    std::uint32_t size;
+    float priority;
+    std::uint32_t revision;
+    // Element references of an unordered_map stay valid on rehash.
+    PairState* pair;
+  };
+
+  void SortCandidates();
+
+  std::uint32_t budget_bytes_;
+  // recipient -> subject -> accumulated state of the pair
+  std::unordered_map<PlayerId, std::unordered_map<PlayerId, PairState>> pairs_;
+  std::unordered_map<PlayerId, PairState>* current_pairs_{nullptr};
+  std::vector<Candidate> candidates_;
+};
@@ -0,0 +1,123 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Players waiting to respawn, ordered by the time they are due.
+ *
+ * A min-heap keyed by the respawn deadline, so checking for due respawns costs
+ * nothing while nobody is dead. Rescheduling or cancelling a player does not
+ * search the heap: the stale heap entry is skipped once it reaches the top, as
+ * only the entry matching the player's current schedule counts.
+ */
+class RespawnQueue {
+public:
+  using PlayerId = std::uint32_t;
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+
+  /**
+   * @brief Schedules the player's respawn, replacing an earlier schedule
+   */
+  void Schedule(PlayerId player_id, TimePoint deadline) {
+    const std::uint64_t sequence = ++next_sequence_;
+    scheduled_[player_id] = sequence;
+    heap_.push_back(Entry{deadline, sequence, player_id});
+    std::push_heap(heap_.begin(), heap_.end(), std::greater<>());
+  }
+
+  /**
+   * @return true if the player was scheduled
+   */
+  bool Cancel(PlayerId player_id) {
+    return scheduled_.erase(player_id) > 0;
+  }
+
+  bool IsScheduled(PlayerId player_id) const {
+    return scheduled_.contains(player_id);
+  }
+
+  /**
+   * @brief Removes every player due at `now` from the queue, in deadline order
+   * @param func Function to call for each due player (receives the PlayerId)
+   */
+  template <typename Func>
+  void PopDue(TimePoint now, Func&& func) {
+    while (!heap_.empty() && heap_.front().deadline <= now) {
+      std::pop_heap(heap_.begin(), heap_.end(), std::greater<>());
+      const Entry entry = heap_.back();
+      heap_.pop_back();
+
+      auto it = scheduled_.find(entry.player_id);
+      if (it == scheduled_.end() || it->second != entry.sequence) {
+        continue;
+      }
+      scheduled_.erase(it);
+      func(entry.player_id);
+    }
+  }
+
+  /**
+   * @brief Gets the earliest deadline, which may belong to a cancelled schedule
+   */
+  std::optional<TimePoint> GetNextDeadline() const {
+    if (heap_.empty()) {
+      return std::nullopt;
+    }
+    return heap_.front().deadline;
+  }
+
+  std::size_t GetScheduledCount() const {
+    return scheduled_.size();
+  }
+
+  void Clear() {
+    heap_.clear();
+    scheduled_.clear();
+  }
+
+private:
+  struct Entry {
+    TimePoint deadline;
+    // Ties on the deadline are broken by scheduling order.
+    std::uint64_t sequence;
+    PlayerId player_id;
+
+    auto operator<=>(const Entry& other) const = default;
+  };
+
+  std::vector<Entry> heap_;
+  // player -> sequence of its current schedule
+  std::unordered_map<PlayerId, std::uint64_t> scheduled_;
+  std::uint64_t next_sequence_{0};
+};
@@ -0,0 +1,148 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "resumable_sessions.h"
+
+#include <sodium.h>
+
+#include <array>
+#include <charconv>
+#include <stdexcept>
+
+namespace {
+
+// A token is the hex encoded player ID, which only selects the session, followed by a random secret.
+constexpr std::size_t kPlayerIdChars = 8;
+constexpr std::size_t kSecretBytes = 16;
+constexpr std::size_t kTokenChars = kPlayerIdChars + kSecretBytes * 2;
+
+void EnsureSodiumInitialized() {
+  static bool initialized = [] {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium for resume tokens");
+    }
+    return true;
+  }();
+  (void)initialized;
+}
+
+std::string GenerateResumeToken(ResumableSessions::PlayerId player_id) {
+  EnsureSodiumInitialized();
+  std::array<unsigned char, kSecretBytes> secret{};
+  randombytes_buf(secret.data(), secret.size());
+
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  std::string token(kTokenChars, '0');
+  for (std::size_t i = 0; i < kPlayerIdChars; ++i) {
+    token[kPlayerIdChars - 1 - i] = kHexDigits[(player_id >> (i * 4)) & 0xF];
+  }
+  for (std::size_t i = 0; i < secret.size(); ++i) {
+    token[kPlayerIdChars + i * 2] = kHexDigits[secret[i] >> 4];
+    token[kPlayerIdChars + i * 2 + 1] = kHexDigits[secret[i] & 0xF];
+  }
+  sodium_memzero(secret.data(), secret.size());
+  return token;
+}
+
+std::optional<ResumableSessions::PlayerId> ParsePlayerId(std::string_view token) {
+  if (token.size() != kTokenChars) {
+    return std::nullopt;
+  }
+
+  ResumableSessions::PlayerId player_id = 0;
+  const char* end = token.data() + kPlayerIdChars;
+  auto [ptr, ec] = std::from_chars(token.data(), end, player_id, 16);
+  if (ec != std::errc() || ptr != end) {
+    return std::nullopt;
+  }
+  return player_id;
+}
+
+}  // namespace
+
+std::string ResumableSessions::IssueToken(PlayerId player_id) {
+  if (!IsEnabled()) {
+    return {};
+  }
+
+  PlayerState& state = players_[player_id];
+  state.token = GenerateResumeToken(player_id);
+  return state.token;
+}
+
+bool ResumableSessions::Suspend(PlayerId player_id, std::vector<PlayerId> known_players, TimePoint now) {
+  auto it = players_.find(player_id);
+  if (it == players_.end() || it->second.token.empty()) {
+    return false;
+  }
+
+  PlayerState& state = it->second;
+  if (!state.suspended) {
+    state.suspended = true;
+    ++suspended_count_;
+  }
+  state.deadline = now + grace_period_;
+  state.known_players = std::move(known_players);
+  return true;
+}
+
+std::optional<ResumableSessions::Session> ResumableSessions::Resume(std::string_view token, TimePoint now) {
+  // The player ID part is not secret, only the comparison of the whole token has to take constant time.
+  auto player_id = ParsePlayerId(token);
+  if (!player_id) {
+    return std::nullopt;
+  }
+
+  auto it = players_.find(*player_id);
+  if (it == players_.end() || it->second.token.size() != token.size()) {
+    return std::nullopt;
+  }
+
+  PlayerState& state = it->second;
+  if (sodium_memcmp(state.token.data(), token.data(), token.size()) != 0) {
+    return std::nullopt;
+  }
+  if (!state.suspended || state.deadline <= now) {
+    return std::nullopt;
+  }
+
+  Session session{*player_id, std::move(state.known_players)};
+  state.token.clear();
+  state.known_players.clear();
+  state.suspended = false;
+  --suspended_count_;
+  return session;
+}
+
+void ResumableSessions::Forget(PlayerId player_id) {
+  auto it = players_.find(player_id);
+  if (it == players_.end()) {
+    return;
+  }
+
+  if (it->second.suspended) {
+    --suspended_count_;
+  }
+  players_.erase(it);
+}
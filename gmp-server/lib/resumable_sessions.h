@@ -0,0 +1,139 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Keeps the sessions of players who lost their connection around for a grace period.
+ *
+ * Every player is handed a resume token with the initial info. When the connection
+ * drops unexpectedly the player is suspended instead of removed: its slot and state
+ * stay in place, and a client presenting the token from a new connection before the
+ * grace period ends takes the player over again instead of going through the whole
+ * join handshake. A token can only be used once, a resumed player gets a new one.
+ *
+ * Tokens carry the player ID to find the session by, followed by 16 random bytes from
+ * libsodium. The presented token is compared with the issued one in constant time.
+ */
+class ResumableSessions {
+public:
+  using PlayerId = std::uint32_t;
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+
+  struct Session {
+    PlayerId player_id;
+    // Joined players the client knew about when it lost the connection
+    std::vector<PlayerId> known_players;
+  };
+
+  /**
+   * @param grace_period How long a suspended session may be resumed, zero disables resuming
+   */
+  explicit ResumableSessions(Clock::duration grace_period = Clock::duration::zero()) : grace_period_(grace_period) {
+  }
+
+  bool IsEnabled() const {
+    return grace_period_ > Clock::duration::zero();
+  }
+
+  Clock::duration GetGracePeriod() const {
+    return grace_period_;
+  }
+
+  /**
+   * @brief Issues a new resume token for the player, the previous one stops working
+   * @return The token, empty if resuming is disabled
+   */
+  std::string IssueToken(PlayerId player_id);
+
+  /**
+   * @brief Suspends the player's session until `now` + the grace period
+   * @return false if the player has no token to resume with, the caller should remove it right away
+   */
+  bool Suspend(PlayerId player_id, std::vector<PlayerId> known_players, TimePoint now);
+
+  /**
+   * @brief Takes the suspended session the token belongs to
+   * @return The session if the token is valid and the session did not expire
+   */
+  std::optional<Session> Resume(std::string_view token, TimePoint now);
+
+  bool IsSuspended(PlayerId player_id) const {
+    auto it = players_.find(player_id);
+    return it != players_.end() && it->second.suspended;
+  }
+
+  /**
+   * @brief Ends the sessions whose grace period is over
+   * @param func Function to call with the PlayerId of every expired session, the player should be removed for good
+   */
+  template <typename Func>
+  void ExpireDue(TimePoint now, Func&& func) {
+    if (suspended_count_ == 0) {
+      return;
+    }
+
+    expired_.clear();
+    for (const auto& [player_id, state] : players_) {
+      if (state.suspended && state.deadline <= now) {
+        expired_.push_back(player_id);
+      }
+    }
+    for (PlayerId player_id : expired_) {
+      Forget(player_id);
+      func(player_id);
+    }
+  }
+
+  /**
+   * @brief Drops the player's token and session, e.g. because it left for good
+   */
+  void Forget(PlayerId player_id);
+
+  std::size_t GetSuspendedCount() const {
+    return suspended_count_;
+  }
+
+private:
+  struct PlayerState {
+    std::string token;
+    bool suspended{false};
+    TimePoint deadline{};
+    std::vector<PlayerId> known_players;
+  };
+
+  Clock::duration grace_period_;
+  std::unordered_map<PlayerId, PlayerState> players_;
+  std::size_t suspended_count_{0};
+  std::vector<PlayerId> expired_;
+};
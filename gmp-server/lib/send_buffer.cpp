@@ -0,0 +1,58 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "send_buffer.h"
+
+#include <utility>
+
+namespace {
+
+// Buffers that grew past this are released instead of pooled, so a single huge packet does not
+// pin its memory for the lifetime of the thread.
+constexpr std::size_t kMaxPooledCapacity = 64 * 1024;
+
+std::vector<std::vector<std::uint8_t>>& ThreadPool() {
+  thread_local std::vector<std::vector<std::uint8_t>> pool;
+  return pool;
+}
+
+}  // namespace
+
+SendBuffer::SendBuffer() {
+  auto& pool = ThreadPool();
+  if (!pool.empty()) {
+    buffer_ = std::move(pool.back());
+    pool.pop_back();
+  }
+}
+
+SendBuffer::~SendBuffer() {
+  if (buffer_.capacity() <= kMaxPooledCapacity) {
+    ThreadPool().push_back(std::move(buffer_));
+  }
+}
+
+std::size_t SendBuffer::GetPooledCount() {
+  return ThreadPool().size();
+}
@@ -0,0 +1,61 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Serialization buffer borrowed from a pool owned by the calling thread.
+ *
+ * The buffer goes back to the pool when the SendBuffer is destroyed and keeps
+ * its capacity, so serializing packets stops allocating once every thread's
+ * pool has warmed up. Several SendBuffers may be alive on one thread at once,
+ * e.g. when a packet is built while another one is still being sent.
+ */
+class SendBuffer {
+public:
+  SendBuffer();
+  ~SendBuffer();
+
+  SendBuffer(const SendBuffer&) = delete;
+  SendBuffer& operator=(const SendBuffer&) = delete;
+
+  /**
+   * @brief The borrowed buffer, its size is whatever it grew to before and not the size of the last packet
+   */
+  std::vector<std::uint8_t>& Get() {
+    return buffer_;
+  }
+
+  /**
+   * @brief Number of idle buffers in the calling thread's pool
+   */
+  static std::size_t GetPooledCount();
+
+private:
+  std::vector<std::uint8_t> buffer_;
+};
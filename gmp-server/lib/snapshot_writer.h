@@ -0,0 +1,100 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Assembles PlayerSnapshotPacket payloads out of already encoded entries.
+ *
+ * Entries are appended as raw bytes (see StateEncodeCache). Whenever the next entry
+ * would push the packet past the size limit, the pending packet is handed to the
+ * flush callback and a new one is started, so a single snapshot never needs to be
+ * fragmented by the transport. The byte layout matches serialize(PlayerSnapshotPacket):
+ * a 1 byte packet type followed by a 2 byte little-endian entry count.
+ */
+class SnapshotWriter {
+public:
+  // Leaves room for the RakNet datagram and message headers below a common 1492 byte MTU.
+  static constexpr std::size_t kDefaultMaxPacketSize = 1200;
+  static constexpr std::size_t kHeaderSize = 3;
+
+  /**
+   * @param packet_type Packet identifier written as the first byte of every packet
+   * @param max_packet_size Size above which a packet is split, entries are never split
+   */
+  explicit SnapshotWriter(std::uint8_t packet_type, std::size_t max_packet_size = kDefaultMaxPacketSize)
+      : packet_type_(packet_type), max_packet_size_(max_packet_size) {
+    Reset();
+  }
+
+  /**
+   * @brief Appends an encoded entry, flushing the pending packet first if the entry does not fit
+   * @param flush Function receiving each finished packet as std::span<const std::uint8_t>
+   */
+  template <typename Flush>
+  void Append(std::span<const std::uint8_t> entry, Flush&& flush) {
+    if (entry_count_ == UINT16_MAX || (entry_count_ > 0 && buffer_.size() + entry.size() > max_packet_size_)) {
+      Finish(flush);
+    }
+    buffer_.insert(buffer_.end(), entry.begin(), entry.end());
+    ++entry_count_;
+  }
+
+  /**
+   * @brief Flushes the pending packet, if it has any entries
+   */
+  template <typename Flush>
+  void Finish(Flush&& flush) {
+    if (entry_count_ == 0) {
+      return;
+    }
+    buffer_[1] = static_cast<std::uint8_t>(entry_count_ & 0xFF);
+    buffer_[2] = static_cast<std::uint8_t>(entry_count_ >> 8);
+    flush(std::span<const std::uint8_t>(buffer_.data(), buffer_.size()));
+    Reset();
+  }
+
+  std::uint16_t GetPendingEntryCount() const {
+    return entry_count_;
+  }
+
+private:
+  void Reset() {
+    buffer_.resize(kHeaderSize);
+    buffer_[0] = packet_type_;
+    buffer_[1] = 0;
+    buffer_[2] = 0;
+    entry_count_ = 0;
+  }
+
+  std::uint8_t packet_type_;
+  std::size_t max_packet_size_;
+  std::uint16_t entry_count_{0};
+  std::vector<std::uint8_t> buffer_;
+};
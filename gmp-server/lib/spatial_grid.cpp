@@ -0,0 +1,92 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "spatial_grid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cell_size) : cell_size_(cell_size) {
+  assert(cell_size_ > 0.0f);
+}
+
+void SpatialGrid::Update(PlayerId player_id, const glm::vec3& position) {
+  const Cell new_cell = CellFor(position);
+
+  auto it = player_cells_.find(player_id);
+  if (it != player_cells_.end()) {
+    if (it->second == new_cell) {
+      return;
+    }
+    RemoveFromCell(it->second, player_id);
+    it->second = new_cell;
+  } else {
+    player_cells_.emplace(player_id, new_cell);
+  }
+
+  cells_[PackCell(new_cell)].push_back(player_id);
+}
+
+bool SpatialGrid::Remove(PlayerId player_id) {
+  auto it = player_cells_.find(player_id);
+  if (it == player_cells_.end()) {
+    return false;
+  }
+
+  RemoveFromCell(it->second, player_id);
+  player_cells_.erase(it);
+  return true;
+}
+
+std::optional<SpatialGrid::Cell> SpatialGrid::GetCell(PlayerId player_id) const {
+  auto it = player_cells_.find(player_id);
+  if (it == player_cells_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+SpatialGrid::Cell SpatialGrid::CellFor(const glm::vec3& position) const {
+  // Gothic uses Y as the vertical axis, height does not matter for relevance.
+  return Cell{static_cast<std::int32_t>(std::floor(position.x / cell_size_)), static_cast<std::int32_t>(std::floor(position.z / cell_size_))};
+}
+
+std::int32_t SpatialGrid::RingForRadius(float radius) const {
+  return std::max(0, static_cast<std::int32_t>(std::ceil(radius / cell_size_)));
+}
+
+void SpatialGrid::RemoveFromCell(const Cell& cell, PlayerId player_id) {
+  auto it = cells_.find(PackCell(cell));
+  if (it == cells_.end()) {
+    return;
+  }
+
+  auto& bucket = it->second;
+  auto player_it = std::find(bucket.begin(), bucket.end(), player_id);
+  if (player_it != bucket.end()) {
+    *player_it = bucket.back();
+    bucket.pop_back();
+  }
+}
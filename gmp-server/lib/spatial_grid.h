@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <glm/glm.hpp>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Uniform spatial hash grid over the horizontal (X/Z) plane.
+ *
+ * Players are bucketed into square cells of a fixed size. The grid is updated
+ * incrementally whenever a player's position changes, and only touches the
+ * cell buckets when the player actually crosses a cell border. Proximity
+ * queries visit the (2 * ring + 1)^2 cells around a center cell, so their
+ * cost depends on local density instead of the total player count.
+ */
+class SpatialGrid {
+public:
+  using PlayerId = std::uint32_t;
+
+  struct Cell {
+    std::int32_t x{0};
+    std::int32_t z{0};
+
+    bool operator==(const Cell& other) const {
+      return x == other.x && z == other.z;
+    }
+  };
+
+  /**
+   * @param cell_size Edge length of a single cell in world units
+   */
+  explicit SpatialGrid(float cell_size);
+
+  /**
+   * @brief Inserts the player or moves it to the cell matching the new position
+   * @param player_id The player ID
+   * @param position The player's current world position
+   */
+  void Update(PlayerId player_id, const glm::vec3& position);
+
+  /**
+   * @brief Removes the player from the grid
+   * @param player_id The player ID
+   * @return true if the player was tracked by the grid, false otherwise
+   */
+  bool Remove(PlayerId player_id);
+
+  /**
+   * @brief Gets the cell the player currently occupies
+   * @param player_id The player ID
+   * @return The cell if the player is tracked by the grid
+   */
+  std::optional<Cell> GetCell(PlayerId player_id) const;
+
+  /**
+   * @brief Maps a world position onto its cell
+   */
+  Cell CellFor(const glm::vec3& position) const;
+
+  /**
+   * @brief Smallest ring of cells guaranteed to contain every point within the given radius
+   */
+  std::int32_t RingForRadius(float radius) const;
+
+  /**
+   * @brief Chebyshev distance between two cells, measured in cells
+   */
+  static std::int32_t CellDistance(const Cell& a, const Cell& b) {
+    return std::max(std::abs(a.x - b.x), std::abs(a.z - b.z));
+  }
+
+  /**
+   * @brief Visits every player whose cell is at most `ring` cells away from `center`
+   * @param func Function to call for each player (receives PlayerId and its Cell)
+   */
+  template <typename Func>
+  void ForEachInRange(const Cell& center, std::int32_t ring, Func&& func) const {
+    for (std::int32_t x = center.x - ring; x <= center.x + ring; ++x) {
+      for (std::int32_t z = center.z - ring; z <= center.z + ring; ++z) {
+        const Cell cell{x, z};
+        auto it = cells_.find(PackCell(cell));
+        if (it == cells_.end()) {
+          continue;
+        }
+        for (PlayerId player_id : it->second) {
+          func(player_id, cell);
+        }
+      }
+    }
+  }
+
+  float GetCellSize() const {
+    return cell_size_;
+  }
+
+  std::size_t GetPlayerCount() const {
+    return player_cells_.size();
+  }
+
+  void Clear() {
+    cells_.clear();
+    player_cells_.clear();
+  }
+
+private:
+  static std::uint64_t PackCell(const Cell& cell) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.x)) << 32) | static_cast<std::uint32_t>(cell.z);
+  }
+
+  void RemoveFromCell(const Cell& cell, PlayerId player_id);
+
+  float cell_size_;
+  // Emptied buckets are kept around so that players walking back and forth
+  // across a border do not reallocate them over and over.
+  std::unordered_map<std::uint64_t, std::vector<PlayerId>> cells_;
+  std::unordered_map<PlayerId, Cell> player_cells_;
+};
@@ -0,0 +1,61 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "state_change_tracker.h"
+
+#include <algorithm>
+
+StateChangeTracker::StateChangeTracker(const Settings& settings) : settings_(settings) {
+  settings_.position_epsilon = std::max(0.0f, settings_.position_epsilon);
+  settings_.keep_alive_ticks = std::max<std::uint32_t>(1, settings_.keep_alive_ticks);
+}
+
+std::uint32_t StateChangeTracker::Update(PlayerId player_id, const PlayerState& state, std::uint64_t tick) {
+  auto [it, inserted] = entries_.try_emplace(player_id);
+  Entry& entry = it->second;
+
+  bool publish = inserted;
+  if (!inserted) {
+    entry.dirty_fields = MakePlayerStateDelta(entry.published, state).changed_fields;
+    if ((entry.dirty_fields & ~kPlayerStatePosition) != 0) {
+      publish = true;
+    } else if ((entry.dirty_fields & kPlayerStatePosition) != 0) {
+      const glm::vec3 drift = state.position - entry.published.position;
+      publish = glm::dot(drift, drift) > settings_.position_epsilon * settings_.position_epsilon;
+    }
+    publish = publish || tick - entry.revision_tick >= settings_.keep_alive_ticks;
+  }
+
+  if (publish) {
+    ++entry.revision;
+    entry.revision_tick = tick;
+    entry.published = state;
+  }
+  return entry.revision;
+}
+
+std::uint16_t StateChangeTracker::GetDirtyFields(PlayerId player_id) const {
+  auto it = entries_.find(player_id);
+  return it != entries_.end() ? it->second.dirty_fields : 0;
+}
@@ -0,0 +1,95 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "common_structs.h"
+
+/**
+ * @brief Decides whether a player's state changed enough to be worth replicating again.
+ *
+ * Every player has a published state, the one recipients were last told about,
+ * and a revision number that is bumped whenever the published state is replaced.
+ * Recipients that already got the current revision have nothing to be sent.
+ *
+ * A new revision is published when a field other than the position changed, when
+ * the position drifted further than `position_epsilon` from where recipients
+ * predict the player to be, or after `keep_alive_ticks` ticks without a new
+ * revision, which repairs recipients that lost the last update on the unreliable
+ * channel. Clients hold a remote player at the last position they received, so
+ * the prediction is the published position.
+ */
+class StateChangeTracker {
+public:
+  using PlayerId = std::uint32_t;
+
+  struct Settings {
+    float position_epsilon{10.0f};
+    std::uint32_t keep_alive_ticks{50};
+  };
+
+  StateChangeTracker() : StateChangeTracker(Settings{}) {
+  }
+  explicit StateChangeTracker(const Settings& settings);
+
+  /**
+   * @brief Compares the player's state against the published one, publishing it as a new revision if needed
+   * @param player_id The replicated player
+   * @param state The player's current state
+   * @param tick The current replication tick
+   * @return The current revision of the player, never 0
+   */
+  std::uint32_t Update(PlayerId player_id, const PlayerState& state, std::uint64_t tick);
+
+  /**
+   * @brief Gets the fields that differed from the published state on the last Update()
+   */
+  std::uint16_t GetDirtyFields(PlayerId player_id) const;
+
+  void RemovePlayer(PlayerId player_id) {
+    entries_.erase(player_id);
+  }
+
+  void Clear() {
+    entries_.clear();
+  }
+
+  const Settings& GetSettings() const {
+    return settings_;
+  }
+
+private:
+  struct Entry {
+    std::uint32_t revision{0};
+    std::uint64_t revision_tick{0};
+    std::uint16_t dirty_fields{0};
+    PlayerState published;
+  };
+
+  Settings settings_;
+  std::unordered_map<PlayerId, Entry> entries_;
+};
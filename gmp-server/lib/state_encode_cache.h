@@ -0,0 +1,117 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <bitsery/adapter/buffer.h>
+#include <bitsery/bitsery.h>
+#include <bitsery/traits/vector.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Tick-scoped storage for the encoded snapshot entries of every replicated player.
+ *
+ * Each player's payloads are serialized once per tick into a single shared byte
+ * buffer, and recipients are sent views into that buffer. All allocations are
+ * retained between ticks, so after warm-up an encode pass only copies bytes.
+ *
+ * Views returned by Get() stay valid until the next call to Store() or Clear().
+ */
+class StateEncodeCache {
+public:
+  using PlayerId = std::uint32_t;
+
+  enum class PayloadKind : std::uint8_t { kKeyframe, kDelta, kMapOnly, kCount };
+
+  /**
+   * @brief Drops the payloads of the previous tick, keeping the allocated memory
+   */
+  void Clear() {
+    buffer_.clear();
+    // Index entries are kept and lazily reset, clearing the map would free its nodes every tick.
+    ++generation_;
+  }
+
+  /**
+   * @brief Forgets the player's index entry, for players that left
+   */
+  void RemovePlayer(PlayerId player_id) {
+    index_.erase(player_id);
+  }
+
+  /**
+   * @brief Serializes the object and stores it as the given payload of the player
+   */
+  template <typename T>
+  void Store(PlayerId player_id, PayloadKind kind, const T& object) {
+    auto written_size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<std::vector<std::uint8_t>>>(scratch_, object);
+
+    Range range{static_cast<std::uint32_t>(buffer_.size()), static_cast<std::uint32_t>(written_size)};
+    buffer_.insert(buffer_.end(), scratch_.begin(), scratch_.begin() + written_size);
+    Entry& entry = index_[player_id];
+    if (entry.generation != generation_) {
+      entry.generation = generation_;
+      entry.ranges = {};
+    }
+    entry.ranges[static_cast<std::size_t>(kind)] = range;
+  }
+
+  /**
+   * @brief Gets the payload stored for the player during this tick
+   */
+  std::optional<std::span<const std::uint8_t>> Get(PlayerId player_id, PayloadKind kind) const {
+    auto it = index_.find(player_id);
+    if (it == index_.end() || it->second.generation != generation_) {
+      return std::nullopt;
+    }
+    const Range& range = it->second.ranges[static_cast<std::size_t>(kind)];
+    if (range.size == 0) {
+      return std::nullopt;
+    }
+    return std::span<const std::uint8_t>(buffer_.data() + range.offset, range.size);
+  }
+
+private:
+  struct Range {
+    std::uint32_t offset{0};
+    std::uint32_t size{0};
+  };
+
+  struct Entry {
+    // Clear() call the ranges were stored after, older ranges are stale
+    std::uint64_t generation{0};
+    std::array<Range, static_cast<std::size_t>(PayloadKind::kCount)> ranges{};
+  };
+
+  std::vector<std::uint8_t> buffer_;
+  std::vector<std::uint8_t> scratch_;
+  std::uint64_t generation_{1};
+  std::unordered_map<PlayerId, Entry> index_;
+};
@@ -0,0 +1,74 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "tick_profiler.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+
+double ToMilliseconds(LatencyHistogram::Duration duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+void TickProfiler::Log(std::string_view title, bool info) const {
+  const auto level = info ? spdlog::level::info : spdlog::level::debug;
+  spdlog::log(level, "{}", title);
+  for (std::size_t i = 0; i < kPhaseCount; ++i) {
+    const auto phase = static_cast<Phase>(i);
+    const auto& histogram = histograms_[i];
+    if (histogram.GetCount() == 0) {
+      continue;
+    }
+    spdlog::log(level, "* {:<12}: p50 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms ({} samples)", GetPhaseName(phase),
+                ToMilliseconds(histogram.Percentile(0.5)), ToMilliseconds(histogram.Percentile(0.99)), ToMilliseconds(histogram.Max()),
+                histogram.GetCount());
+  }
+}
+
+std::string_view TickProfiler::GetPhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::kPulse:
+      return "Pulse";
+    case Phase::kClock:
+      return "Clock";
+    case Phase::kTimers:
+      return "Lua timers";
+    case Phase::kRespawns:
+      return "Respawns";
+    case Phase::kSessions:
+      return "Sessions";
+    case Phase::kJoinStreams:
+      return "Join streams";
+    case Phase::kReplication:
+      return "Replication";
+    case Phase::kOutbound:
+      return "Outbound";
+    case Phase::kCount:
+      break;
+  }
+  return "Unknown";
+}
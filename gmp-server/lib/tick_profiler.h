@@ -0,0 +1,105 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "latency_histogram.h"
+
+/**
+ * @brief Per-phase timing of the server main loop.
+ *
+ * Each phase of GameServer::Run() is timed with a Scope and recorded into a
+ * histogram of its own. Recording costs two steady_clock reads and a histogram
+ * update, so the profiler stays enabled in production builds. It is not thread
+ * safe: all phases are recorded on the main thread, which also reports them.
+ */
+class TickProfiler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Phase : std::uint8_t {
+    kPulse,
+    kClock,
+    kTimers,
+    kRespawns,
+    kSessions,
+    kJoinStreams,
+    kReplication,
+    kOutbound,
+    kCount,
+  };
+
+  static constexpr std::size_t kPhaseCount = static_cast<std::size_t>(Phase::kCount);
+
+  /**
+   * @brief Records the lifetime of the scope as one sample of the phase
+   */
+  class Scope {
+  public:
+    Scope(TickProfiler& profiler, Phase phase) : profiler_(profiler), phase_(phase), start_(Clock::now()) {
+    }
+    ~Scope() {
+      profiler_.Record(phase_, Clock::now() - start_);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    TickProfiler& profiler_;
+    Phase phase_;
+    Clock::time_point start_;
+  };
+
+  void Record(Phase phase, Clock::duration duration) {
+    histograms_[static_cast<std::size_t>(phase)].Record(duration);
+  }
+
+  const LatencyHistogram& GetHistogram(Phase phase) const {
+    return histograms_[static_cast<std::size_t>(phase)];
+  }
+
+  /**
+   * @brief Logs p50, p99 and max of every phase that recorded samples since the last Reset()
+   * @param title Headline of the report
+   * @param info Logs at info level if true, at debug level otherwise
+   */
+  void Log(std::string_view title, bool info) const;
+
+  void Reset() {
+    for (auto& histogram : histograms_) {
+      histogram.Reset();
+    }
+  }
+
+  static std::string_view GetPhaseName(Phase phase);
+
+private:
+  std::array<LatencyHistogram, kPhaseCount> histograms_;
+};
@@ -0,0 +1,92 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "tick_rate_controller.h"
+
+#include <algorithm>
+
+namespace {
+
+// Weight of the newest sample in the moving averages, about the last ten ticks count.
+constexpr double kSmoothing = 0.1;
+// Largest share of the period it may shrink by per tick.
+constexpr double kMaxShrink = 0.1;
+
+}  // namespace
+
+TickRateController::TickRateController(const Settings& settings) : settings_(settings) {
+  settings_.min_period = std::max(settings_.min_period, Duration(1));
+  settings_.max_period = std::max(settings_.max_period, settings_.min_period);
+  settings_.target_utilization = std::clamp(settings_.target_utilization, 0.05, 1.0);
+  period_ = settings_.max_period;
+}
+
+void TickRateController::Reset(Duration period) {
+  period_ = Clamp(period);
+  smoothed_cost_seconds_ = 0.0;
+  smoothed_outbound_bytes_ = 0.0;
+  has_samples_ = false;
+}
+
+TickRateController::Duration TickRateController::Update(const Sample& sample) {
+  if (!IsAdaptive()) {
+    return period_;
+  }
+
+  const double cost_seconds = std::chrono::duration<double>(sample.cost).count();
+  const double outbound_bytes = static_cast<double>(sample.outbound_bytes);
+  if (has_samples_) {
+    smoothed_cost_seconds_ += kSmoothing * (cost_seconds - smoothed_cost_seconds_);
+    smoothed_outbound_bytes_ += kSmoothing * (outbound_bytes - smoothed_outbound_bytes_);
+  } else {
+    smoothed_cost_seconds_ = cost_seconds;
+    smoothed_outbound_bytes_ = outbound_bytes;
+    has_samples_ = true;
+  }
+
+  const double min_seconds = std::chrono::duration<double>(settings_.min_period).count();
+  const double max_seconds = std::chrono::duration<double>(settings_.max_period).count();
+
+  double wanted_seconds = smoothed_cost_seconds_ / settings_.target_utilization;
+  if (settings_.full_load_players > 0) {
+    const double density = std::min(1.0, static_cast<double>(sample.player_count) / settings_.full_load_players);
+    wanted_seconds = std::max(wanted_seconds, min_seconds + (max_seconds - min_seconds) * density);
+  }
+  if (settings_.max_outbound_bytes_per_second > 0) {
+    wanted_seconds = std::max(wanted_seconds, smoothed_outbound_bytes_ / static_cast<double>(settings_.max_outbound_bytes_per_second));
+  }
+
+  const auto wanted = Clamp(std::chrono::duration_cast<Duration>(std::chrono::duration<double>(wanted_seconds)));
+  if (wanted >= period_) {
+    period_ = wanted;
+  } else {
+    const auto shrink_limit = std::chrono::duration_cast<Duration>(std::chrono::duration<double>(period_) * (1.0 - kMaxShrink));
+    period_ = Clamp(std::max(wanted, shrink_limit));
+  }
+  return period_;
+}
+
+TickRateController::Duration TickRateController::Clamp(Duration period) const {
+  return std::clamp(period, settings_.min_period, settings_.max_period);
+}
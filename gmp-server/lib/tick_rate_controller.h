@@ -0,0 +1,102 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Picks the replication tick period between a minimum and a maximum from the load of recent ticks.
+ *
+ * Three limits each ask for a period, the longest one wins:
+ * - the tick cost, so a tick takes at most `target_utilization` of its period,
+ * - the player count, which moves the period from the minimum towards the
+ *   maximum as it approaches `full_load_players`, before the cost catches up,
+ * - the bytes queued per tick, so replication stays below `max_outbound_bytes_per_second`.
+ *
+ * Cost and outbound bytes are smoothed over recent ticks. The period grows to
+ * what the load asks for right away, but shrinks by at most a tenth per tick,
+ * so a single cheap tick does not make it oscillate.
+ */
+class TickRateController {
+public:
+  using Duration = std::chrono::steady_clock::duration;
+
+  struct Settings {
+    Duration min_period{std::chrono::milliseconds(33)};
+    Duration max_period{std::chrono::milliseconds(100)};
+    double target_utilization{0.5};
+    std::uint32_t full_load_players{150};
+    // 0 for no limit
+    std::uint64_t max_outbound_bytes_per_second{0};
+  };
+
+  struct Sample {
+    // Time the tick took, from gathering the players to queueing the last packet
+    Duration cost{Duration::zero()};
+    std::size_t player_count{0};
+    std::size_t outbound_bytes{0};
+  };
+
+  TickRateController() : TickRateController(Settings{}) {
+  }
+  explicit TickRateController(const Settings& settings);
+
+  /**
+   * @brief Takes the measurements of the tick that just ran
+   * @return The period to run the next tick at
+   */
+  Duration Update(const Sample& sample);
+
+  Duration GetPeriod() const {
+    return period_;
+  }
+
+  /**
+   * @brief Ticks per second at the current period
+   */
+  double GetRate() const {
+    return 1.0 / std::chrono::duration<double>(period_).count();
+  }
+
+  bool IsAdaptive() const {
+    return settings_.min_period < settings_.max_period;
+  }
+
+  /**
+   * @brief Starts over at the given period, forgetting the measurements so far
+   */
+  void Reset(Duration period);
+
+private:
+  Duration Clamp(Duration period) const;
+
+  Settings settings_;
+  Duration period_{};
+  double smoothed_cost_seconds_{0.0};
+  double smoothed_outbound_bytes_{0.0};
+  bool has_samples_{false};
+};
@@ -0,0 +1,101 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "worker_pool.h"
+
+#include <algorithm>
+
+namespace {
+// Replication work is spread over recipients, more threads than this only add wake-up latency.
+constexpr std::size_t kMaxAutoWorkers = 8;
+}  // namespace
+
+WorkerPool::WorkerPool(std::size_t worker_count) {
+  worker_count = std::max<std::size_t>(1, worker_count);
+  threads_.reserve(worker_count - 1);
+  for (std::size_t i = 1; i < worker_count; ++i) {
+    threads_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  job_ready_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkerPool::RunOnAll(const std::function<void(std::size_t)>& job) {
+  if (threads_.empty()) {
+    job(0);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &job;
+    pending_ = threads_.size();
+    ++generation_;
+  }
+  job_ready_.notify_all();
+
+  job(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  job_done_.wait(lock, [this] { return pending_ == 0; });
+  job_ = nullptr;
+}
+
+std::size_t WorkerPool::ResolveWorkerCount(std::uint32_t requested) {
+  if (requested != 0) {
+    return requested;
+  }
+  const std::size_t hardware = std::thread::hardware_concurrency();
+  return std::clamp<std::size_t>(hardware, 1, kMaxAutoWorkers);
+}
+
+void WorkerPool::WorkerLoop(std::size_t worker_index) {
+  std::uint64_t seen_generation = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    job_ready_.wait(lock, [&] { return stopping_ || generation_ != seen_generation; });
+    if (stopping_) {
+      return;
+    }
+    seen_generation = generation_;
+    const auto* job = job_;
+
+    lock.unlock();
+    (*job)(worker_index);
+    lock.lock();
+
+    if (--pending_ == 0) {
+      job_done_.notify_one();
+    }
+  }
+}
@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed set of threads running fork-join jobs.
+ *
+ * A job is run once for every worker index; index 0 runs on the calling thread
+ * while the others run on persistent pool threads, so a pool of one worker
+ * never leaves the caller. RunOnAll returns only after every worker finished,
+ * which makes it a barrier: whatever the caller wrote before the call is
+ * visible to the job, and whatever the job wrote is visible after it.
+ */
+class WorkerPool {
+public:
+  /**
+   * @param worker_count Number of workers including the calling thread, 0 is treated as 1
+   */
+  explicit WorkerPool(std::size_t worker_count);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * @brief Runs `job(worker_index)` for every worker index and waits until all of them returned
+   * @param job Function to run, must not throw
+   */
+  void RunOnAll(const std::function<void(std::size_t)>& job);
+
+  std::size_t GetWorkerCount() const {
+    return threads_.size() + 1;
+  }
+
+  /**
+   * @brief Picks a worker count for the given setting, 0 selects one based on the hardware
+   */
+  static std::size_t ResolveWorkerCount(std::uint32_t requested);
+
+private:
+  void WorkerLoop(std::size_t worker_index);
+
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+  std::condition_variable job_done_;
+  const std::function<void(std::size_t)>* job_{nullptr};
+  std::uint64_t generation_{0};
+  std::size_t pending_{0};
+  bool stopping_{false};
+  std::vector<std::thread> threads_;
+};
@@ -26,9 +26,11 @@ SOFTWARE.
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 
 #include "net_enums.h"
+#include "net_streams.h"
 
 namespace Net {
 
@@ -47,14 +49,26 @@ public:
   // Needs to be called periodically in order to retrieve packets.
   virtual void Pulse() = 0;
 
+  // Blocks until a packet is ready to be retrieved by Pulse() or the timeout elapses, whichever comes first.
+  // Returns true if woken up by a packet.
+  virtual bool WaitForPackets(std::uint32_t timeout_us) = 0;
+
   virtual bool Start(std::uint32_t port, std::uint32_t slots) = 0;
 
+  // `channel` is the stream the message is ordered or sequenced on, see net_streams.h.
   virtual bool Send(unsigned char* data, std::uint32_t size, PacketPriority packetPriority,
                     PacketReliability packetReliability, std::uint32_t channel, ConnectionHandle id) = 0;
 
   virtual bool Send(const char* data, std::uint32_t size, PacketPriority packetPriority,
                     PacketReliability packetReliability, std::uint32_t channel, ConnectionHandle id) = 0;
 
+  // Sends bytes the caller keeps ownership of, e.g. a pooled or shared serialization buffer.
+  virtual bool Send(std::span<const std::uint8_t> data, PacketPriority packetPriority, PacketReliability packetReliability,
+                    std::uint32_t channel, ConnectionHandle id) = 0;
+
+  // Messages and bytes sent on the stream since the server was started.
+  virtual StreamStats GetStreamStats(std::uint32_t stream) const = 0;
+
   virtual void AddToBanList(const char* IP, std::uint32_t milliseconds) = 0;
   virtual void AddToBanList(ConnectionHandle id, std::uint32_t milliseconds) = 0;
   virtual void RemoveFromBanList(const char* IP) = 0;
@@ -62,6 +76,9 @@ public:
 
   virtual const char* GetPlayerIp(ConnectionHandle id) = 0;
 
+  // Average round trip time to the connection in milliseconds, -1 if it is not known.
+  virtual std::int32_t GetAveragePing(ConnectionHandle id) = 0;
+
   virtual void AddPacketHandler(PacketHandler& packetHandler) = 0;
   virtual void RemovePacketHandler(PacketHandler& packetHandler) = 0;
   virtual std::uint32_t GetPort() const = 0;
@@ -28,6 +28,7 @@ SOFTWARE.
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
 #include <string>
 #include <string_view>
 
@@ -57,6 +58,10 @@ namespace {
       return ::RELIABLE_ORDERED;
     case UNRELIABLE:
       return ::UNRELIABLE;
+    case UNRELIABLE_SEQUENCED:
+      return ::UNRELIABLE_SEQUENCED;
+    case RELIABLE_SEQUENCED:
+      return ::RELIABLE_SEQUENCED;
   }
   return ::RELIABLE;
 }
@@ -77,31 +82,63 @@ bool RakNetServer::Start(std::uint32_t port, std::uint32_t slots) {
   peer_->SetIncomingPassword(kServerPassword.data(), kServerPassword.size());
   peer_->SetTimeoutTime(1000, RakNet::UNASSIGNED_SYSTEM_ADDRESS);
   peer_->SetMaximumIncomingConnections(slots);
+  peer_->SetPacketReadyEventHandler(&RakNetServer::OnPacketReady, this);
 
   RakNet::SocketDescriptor socketDescriptor{static_cast<unsigned short>(port), nullptr};
   return peer_->Startup(slots, &socketDescriptor, 1) == RakNet::RAKNET_STARTED;
 }
 
 void RakNetServer::Pulse() {
+  {
+    // Everything queued so far is drained below.
+    std::lock_guard<std::mutex> lock(packet_ready_mutex_);
+    packet_ready_ = false;
+  }
+
   for (RakNet::Packet* packet = peer_->Receive(); packet; peer_->DeallocatePacket(packet), packet = peer_->Receive()) {
     std::for_each(packetHandlers_.begin(), packetHandlers_.end(),
                   [packet](auto& handler) { handler->HandlePacket(ConnectionHandle{packet->guid.g}, packet->data, packet->length); });
   }
 }
 
+bool RakNetServer::WaitForPackets(std::uint32_t timeout_us) {
+  std::unique_lock<std::mutex> lock(packet_ready_mutex_);
+  const bool ready = packet_ready_cv_.wait_for(lock, std::chrono::microseconds(timeout_us), [this] { return packet_ready_; });
+  packet_ready_ = false;
+  return ready;
+}
+
+void RakNetServer::OnPacketReady(void* user_data) {
+  auto* server = static_cast<RakNetServer*>(user_data);
+  {
+    std::lock_guard<std::mutex> lock(server->packet_ready_mutex_);
+    server->packet_ready_ = true;
+  }
+  server->packet_ready_cv_.notify_one();
+}
+
 bool RakNetServer::Send(unsigned char* data, std::uint32_t size, PacketPriority packetPriority, PacketReliability packetReliability,
                         std::uint32_t channel, ConnectionHandle id) {
-  peer_->Send(reinterpret_cast<const char*>(data), size, ToRakNetPacketPriority(packetPriority), ToRakNetPacketReliability(packetReliability), 0,
-              RakNet::RakNetGUID(id), false);
-  return true;
+  return Send(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(data), size), packetPriority, packetReliability, channel, id);
 }
 bool RakNetServer::Send(const char* data, std::uint32_t size, PacketPriority packetPriority, PacketReliability packetReliability,
                         std::uint32_t channel, ConnectionHandle id) {
-  peer_->Send(reinterpret_cast<const char*>(data), size, ToRakNetPacketPriority(packetPriority), ToRakNetPacketReliability(packetReliability), 0,
-              RakNet::RakNetGUID(id), false);
+  return Send(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(data), size), packetPriority, packetReliability, channel, id);
+}
+bool RakNetServer::Send(std::span<const std::uint8_t> data, PacketPriority packetPriority, PacketReliability packetReliability,
+                        std::uint32_t channel, ConnectionHandle id) {
+  // RakNet copies the data into its own send queue, the span only has to outlive the call.
+  const std::uint32_t stream = StreamCounters::Resolve(channel);
+  peer_->Send(reinterpret_cast<const char*>(data.data()), static_cast<int>(data.size()), ToRakNetPacketPriority(packetPriority),
+              ToRakNetPacketReliability(packetReliability), static_cast<char>(stream), RakNet::RakNetGUID(id), false);
+  stream_counters_.Record(stream, static_cast<std::uint32_t>(data.size()));
   return true;
 }
 
+StreamStats RakNetServer::GetStreamStats(std::uint32_t stream) const {
+  return stream_counters_.Get(stream);
+}
+
 void RakNetServer::AddPacketHandler(PacketHandler& packetHandler) {
   packetHandlers_.insert(&packetHandler);
 }
@@ -128,6 +165,10 @@ const char* RakNetServer::GetPlayerIp(ConnectionHandle id) {
   return address.ToString(false);
 }
 
+std::int32_t RakNetServer::GetAveragePing(ConnectionHandle id) {
+  return peer_->GetAveragePing(RakNet::RakNetGUID(id));
+}
+
 void RakNetServer::AddToBanList(ConnectionHandle id, std::uint32_t milliseconds) {
   auto address = peer_->GetSystemAddressFromGuid(RakNet::RakNetGUID(id));
   if (address != RakNet::UNASSIGNED_SYSTEM_ADDRESS) {
@@ -26,7 +26,9 @@ SOFTWARE.
 
 #include <RakPeerInterface.h>
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <unordered_set>
 
 #include "znet_server.h"
@@ -40,6 +42,7 @@ public:
   bool Start(std::uint32_t port, std::uint32_t slots) override;
 
   void Pulse() override;
+  bool WaitForPackets(std::uint32_t timeout_us) override;
 
   void AddPacketHandler(PacketHandler& packetHandler) override;
   void RemovePacketHandler(PacketHandler& packetHandler) override;
@@ -50,18 +53,32 @@ public:
   bool Send(const char* data, std::uint32_t size, PacketPriority packetPriority, PacketReliability packetReliability,
             std::uint32_t channel, ConnectionHandle id) override;
 
+  bool Send(std::span<const std::uint8_t> data, PacketPriority packetPriority, PacketReliability packetReliability, std::uint32_t channel,
+            ConnectionHandle id) override;
+
+  StreamStats GetStreamStats(std::uint32_t stream) const override;
+
   void AddToBanList(const char* IP, std::uint32_t milliseconds) override;
   void AddToBanList(ConnectionHandle id, std::uint32_t milliseconds) override;
   void RemoveFromBanList(const char* IP) override;
   bool IsBanned(const char* IP) override;
 
   const char* GetPlayerIp(ConnectionHandle id) override;
+  std::int32_t GetAveragePing(ConnectionHandle id) override;
   std::uint32_t GetPort() const override;
   std::string GetAddress() const override;
 
 private:
+  // Called by RakNet's threads whenever a packet is queued for Receive().
+  static void OnPacketReady(void* user_data);
+
   RakNet::RakPeerInterface* peer_{nullptr};
   std::unordered_set<PacketHandler*> packetHandlers_;
+  StreamCounters stream_counters_;
+
+  std::mutex packet_ready_mutex_;
+  std::condition_variable packet_ready_cv_;
+  bool packet_ready_{false};
 };
 
 }  // namespace Net
@@ -0,0 +1,122 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "area_events.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace {
+
+class AreaEventsTest : public ::testing::Test {
+protected:
+  PlayerManager::PlayerId AddPlayer(Net::ConnectionHandle connection, const glm::vec3& position, bool ingame = true) {
+    const auto player_id = players_.AddPlayer(connection, "player");
+    players_.SetIngame(player_id, ingame);
+    players_.SetPosition(player_id, position);
+    grid_.Update(player_id, position);
+    return player_id;
+  }
+
+  std::vector<PlayerManager::PlayerId> Recipients(const glm::vec3& origin, float radius, std::optional<PlayerManager::PlayerId> target_id) {
+    std::vector<PlayerManager::PlayerId> recipients;
+    area_events::ForEachRecipient(players_, grid_, origin, radius, target_id,
+                                  [&](const PlayerManager::Player& player) { recipients.push_back(player.player_id); });
+    std::sort(recipients.begin(), recipients.end());
+    return recipients;
+  }
+
+  PlayerManager players_;
+  SpatialGrid grid_{1000.0f};
+};
+
+TEST_F(AreaEventsTest, OnlyPlayersWithinTheRadiusAreVisited) {
+  const auto near = AddPlayer(1, {100.0f, 0.0f, 100.0f});
+  const auto at_border = AddPlayer(2, {3000.0f, 0.0f, 4000.0f});
+  AddPlayer(3, {3000.0f, 0.0f, 4100.0f});
+  AddPlayer(4, {-20000.0f, 0.0f, 0.0f});
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 5000.0f, std::nullopt), (std::vector<PlayerManager::PlayerId>{near, at_border}));
+}
+
+TEST_F(AreaEventsTest, HeightDoesNotCount) {
+  const auto above = AddPlayer(1, {0.0f, 50000.0f, 0.0f});
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 100.0f, std::nullopt), (std::vector<PlayerManager::PlayerId>{above}));
+}
+
+TEST_F(AreaEventsTest, PlayersNotInGameAreSkipped) {
+  const auto ingame = AddPlayer(1, {0.0f, 0.0f, 0.0f});
+  AddPlayer(2, {10.0f, 0.0f, 0.0f}, false);
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 5000.0f, std::nullopt), (std::vector<PlayerManager::PlayerId>{ingame}));
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 0.0f, std::nullopt), (std::vector<PlayerManager::PlayerId>{ingame}));
+}
+
+TEST_F(AreaEventsTest, NonPositiveRadiusReachesEveryone) {
+  const auto first = AddPlayer(1, {0.0f, 0.0f, 0.0f});
+  const auto second = AddPlayer(2, {100000.0f, 0.0f, -100000.0f});
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 0.0f, std::nullopt), (std::vector<PlayerManager::PlayerId>{first, second}));
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, -1.0f, std::nullopt), (std::vector<PlayerManager::PlayerId>{first, second}));
+  EXPECT_TRUE(area_events::IsInArea({0.0f, 0.0f, 0.0f}, {100000.0f, 0.0f, 0.0f}, 0.0f));
+}
+
+TEST_F(AreaEventsTest, TargetOutsideTheRadiusStillReceivesTheEvent) {
+  const auto caster = AddPlayer(1, {0.0f, 0.0f, 0.0f});
+  const auto target = AddPlayer(2, {9000.0f, 0.0f, 0.0f});
+  AddPlayer(3, {-9000.0f, 0.0f, 0.0f});
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 5000.0f, target), (std::vector<PlayerManager::PlayerId>{caster, target}));
+}
+
+TEST_F(AreaEventsTest, TargetInsideTheRadiusIsVisitedOnce) {
+  const auto caster = AddPlayer(1, {0.0f, 0.0f, 0.0f});
+  const auto target = AddPlayer(2, {1000.0f, 0.0f, 0.0f});
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 5000.0f, target), (std::vector<PlayerManager::PlayerId>{caster, target}));
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 0.0f, target), (std::vector<PlayerManager::PlayerId>{caster, target}));
+}
+
+TEST_F(AreaEventsTest, TargetThatLeftTheGameIsSkipped) {
+  const auto caster = AddPlayer(1, {0.0f, 0.0f, 0.0f});
+  const auto target = AddPlayer(2, {9000.0f, 0.0f, 0.0f});
+  players_.SetIngame(target, false);
+
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 5000.0f, target), (std::vector<PlayerManager::PlayerId>{caster}));
+
+  ASSERT_TRUE(players_.RemovePlayer(target));
+  EXPECT_EQ(Recipients({0.0f, 0.0f, 0.0f}, 5000.0f, target), (std::vector<PlayerManager::PlayerId>{caster}));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -42,14 +42,19 @@ namespace {
 class MockNetServer : public Net::NetServer {
 public:
   MOCK_METHOD(void, Pulse, (), (override));
+  MOCK_METHOD(bool, WaitForPackets, (std::uint32_t), (override));
   MOCK_METHOD(bool, Start, (std::uint32_t, std::uint32_t), (override));
   MOCK_METHOD(bool, Send, (unsigned char*, std::uint32_t, Net::PacketPriority, Net::PacketReliability, std::uint32_t, Net::ConnectionHandle), (override));
   MOCK_METHOD(bool, Send, (const char*, std::uint32_t, Net::PacketPriority, Net::PacketReliability, std::uint32_t, Net::ConnectionHandle), (override));
+  MOCK_METHOD(bool, Send, (std::span<const std::uint8_t>, Net::PacketPriority, Net::PacketReliability, std::uint32_t, Net::ConnectionHandle),
+              (override));
+  MOCK_METHOD(Net::StreamStats, GetStreamStats, (std::uint32_t), (const override));
   MOCK_METHOD(void, AddToBanList, (const char*, std::uint32_t), (override));
   MOCK_METHOD(void, AddToBanList, (Net::ConnectionHandle, std::uint32_t), (override));
   MOCK_METHOD(void, RemoveFromBanList, (const char*), (override));
   MOCK_METHOD(bool, IsBanned, (const char*), (override));
   MOCK_METHOD(const char*, GetPlayerIp, (Net::ConnectionHandle), (override));
+  MOCK_METHOD(std::int32_t, GetAveragePing, (Net::ConnectionHandle), (override));
   MOCK_METHOD(void, AddPacketHandler, (Net::PacketHandler&), (override));
   MOCK_METHOD(void, RemovePacketHandler, (Net::PacketHandler&), (override));
   MOCK_METHOD(std::uint32_t, GetPort, (), (const override));
@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "connection_index.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_map>
+
+TEST(ConnectionIndexTest, FindsInsertedConnections) {
+  ConnectionIndex index;
+  EXPECT_FALSE(index.Find(1).has_value());
+
+  index.Insert(1, 10);
+  index.Insert(2, 20);
+  index.Insert(1, 11);
+
+  EXPECT_EQ(index.GetSize(), 2u);
+  EXPECT_EQ(index.Find(1), 11u);
+  EXPECT_EQ(index.Find(2), 20u);
+  EXPECT_FALSE(index.Contains(3));
+}
+
+TEST(ConnectionIndexTest, EraseKeepsTheRestOfTheClusterReachable) {
+  ConnectionIndex index;
+  for (Net::ConnectionHandle connection = 0; connection < 1000; ++connection) {
+    index.Insert(connection, static_cast<ConnectionIndex::Value>(connection));
+  }
+  for (Net::ConnectionHandle connection = 0; connection < 1000; connection += 3) {
+    EXPECT_TRUE(index.Erase(connection));
+  }
+  EXPECT_FALSE(index.Erase(0));
+
+  for (Net::ConnectionHandle connection = 0; connection < 1000; ++connection) {
+    if (connection % 3 == 0) {
+      EXPECT_FALSE(index.Contains(connection)) << connection;
+    } else {
+      EXPECT_EQ(index.Find(connection), connection) << connection;
+    }
+  }
+}
+
+TEST(ConnectionIndexTest, MatchesAStandardMapUnderChurn) {
+  ConnectionIndex index;
+  std::unordered_map<Net::ConnectionHandle, ConnectionIndex::Value> expected;
+  std::mt19937_64 random(42);
+
+  for (int i = 0; i < 20000; ++i) {
+    // A small key range makes inserts, overwrites and erases of the same keys collide often.
+    const Net::ConnectionHandle connection = random() % 512;
+    if (random() % 3 == 0) {
+      EXPECT_EQ(index.Erase(connection), expected.erase(connection) > 0);
+    } else {
+      const auto value = static_cast<ConnectionIndex::Value>(random());
+      index.Insert(connection, value);
+      expected[connection] = value;
+    }
+  }
+
+  EXPECT_EQ(index.GetSize(), expected.size());
+  for (Net::ConnectionHandle connection = 0; connection < 512; ++connection) {
+    auto it = expected.find(connection);
+    if (it == expected.end()) {
+      EXPECT_FALSE(index.Contains(connection));
+    } else {
+      EXPECT_EQ(index.Find(connection), it->second);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
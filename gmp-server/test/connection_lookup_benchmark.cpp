@@ -0,0 +1,98 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Measures the cost of resolving the sender of an inbound packet, which every packet
+// handler does through PlayerManager::GetPlayerByConnection. The "before" numbers come
+// from the two hash maps the manager used to chain (connection -> ID -> player).
+//
+// Usage: ConnectionLookupBenchmark [player count] [lookups]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "player_manager.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Func>
+double NanosecondsPerLookup(const std::vector<Net::ConnectionHandle>& lookups, Func&& lookup) {
+  std::uint64_t checksum = 0;
+  const auto start = Clock::now();
+  for (Net::ConnectionHandle connection : lookups) {
+    checksum += lookup(connection);
+  }
+  const auto elapsed = Clock::now() - start;
+  // Keeps the lookups from being optimized out.
+  if (checksum == 1) {
+    std::puts("");
+  }
+  return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(lookups.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t player_count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500;
+  const std::size_t lookup_count = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10'000'000;
+
+  std::mt19937_64 random(42);
+  std::vector<Net::ConnectionHandle> connections;
+  PlayerManager manager;
+  std::unordered_map<Net::ConnectionHandle, PlayerManager::PlayerId> connection_to_player;
+  std::unordered_map<PlayerManager::PlayerId, PlayerManager::Player> players;
+  for (std::size_t i = 0; i < player_count; ++i) {
+    const Net::ConnectionHandle connection = random();
+    const auto player_id = manager.AddPlayer(connection, "player" + std::to_string(i));
+    connections.push_back(connection);
+    connection_to_player[connection] = player_id;
+    players[player_id] = manager.GetPlayer(player_id)->get();
+  }
+
+  std::vector<Net::ConnectionHandle> lookups(lookup_count);
+  for (auto& connection : lookups) {
+    connection = connections[random() % connections.size()];
+  }
+
+  const double before = NanosecondsPerLookup(lookups, [&](Net::ConnectionHandle connection) -> std::uint64_t {
+    auto it = connection_to_player.find(connection);
+    return it == connection_to_player.end() ? 0 : players.find(it->second)->second.player_id;
+  });
+  const double after = NanosecondsPerLookup(lookups, [&](Net::ConnectionHandle connection) -> std::uint64_t {
+    auto player = manager.GetPlayerByConnection(connection);
+    return player ? player->get().player_id : 0;
+  });
+
+  std::printf("%zu players, %zu lookups\n", player_count, lookup_count);
+  std::printf("two hash maps:    %.2f ns per lookup\n", before);
+  std::printf("connection index: %.2f ns per lookup\n", after);
+  return 0;
+}
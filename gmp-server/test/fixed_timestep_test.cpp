@@ -0,0 +1,107 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "fixed_timestep.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace {
+
+using namespace std::chrono_literals;
+using TimePoint = FixedTimestep::TimePoint;
+
+const TimePoint kStart{};
+
+}  // namespace
+
+TEST(FixedTimestepTest, NothingIsDueBeforeTheFirstDeadline) {
+  FixedTimestep timestep(100ms, FixedTimestep::OverrunPolicy::kSkip, kStart);
+
+  EXPECT_EQ(timestep.Advance(kStart), 0u);
+  EXPECT_EQ(timestep.Advance(kStart + 99ms), 0u);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 100ms);
+}
+
+TEST(FixedTimestepTest, DeadlinesDoNotDriftWithLateTicks) {
+  FixedTimestep timestep(100ms, FixedTimestep::OverrunPolicy::kSkip, kStart);
+
+  EXPECT_EQ(timestep.Advance(kStart + 130ms), 1u);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 200ms);
+  EXPECT_EQ(timestep.Advance(kStart + 205ms), 1u);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 300ms);
+
+  const auto& stats = timestep.GetStats();
+  EXPECT_EQ(stats.ticks, 2u);
+  EXPECT_EQ(stats.late_ticks, 1u);
+  EXPECT_EQ(stats.worst_lateness, 30ms);
+}
+
+TEST(FixedTimestepTest, SkipPolicyRunsOneTickOnOverrun) {
+  FixedTimestep timestep(100ms, FixedTimestep::OverrunPolicy::kSkip, kStart);
+
+  EXPECT_EQ(timestep.Advance(kStart + 450ms), 1u);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 500ms);
+  EXPECT_EQ(timestep.GetStats().skipped_ticks, 3u);
+  EXPECT_EQ(timestep.GetStats().worst_lateness, 350ms);
+}
+
+TEST(FixedTimestepTest, CatchUpPolicyRunsOverdueTicksUpToTheLimit) {
+  FixedTimestep timestep(10ms, FixedTimestep::OverrunPolicy::kCatchUp, kStart);
+  timestep.SetMaxCatchUpTicks(3);
+
+  EXPECT_EQ(timestep.Advance(kStart + 25ms), 2u);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 30ms);
+
+  EXPECT_EQ(timestep.Advance(kStart + 95ms), 3u);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 100ms);
+  EXPECT_EQ(timestep.GetStats().ticks, 5u);
+  EXPECT_EQ(timestep.GetStats().skipped_ticks, 4u);
+}
+
+TEST(FixedTimestepTest, SetPeriodKeepsTheLastDeadline) {
+  FixedTimestep timestep(100ms, FixedTimestep::OverrunPolicy::kSkip, kStart);
+  EXPECT_EQ(timestep.Advance(kStart + 100ms), 1u);
+
+  timestep.SetPeriod(50ms);
+  EXPECT_EQ(timestep.GetNextDeadline(), kStart + 150ms);
+  EXPECT_EQ(timestep.GetPeriod(), 50ms);
+}
+
+TEST(FixedTimestepTest, ResetStatsClearsCounters) {
+  FixedTimestep timestep(100ms, FixedTimestep::OverrunPolicy::kSkip, kStart);
+  timestep.Advance(kStart + 450ms);
+  timestep.ResetStats();
+
+  EXPECT_EQ(timestep.GetStats().ticks, 0u);
+  EXPECT_EQ(timestep.GetStats().skipped_ticks, 0u);
+  EXPECT_EQ(timestep.GetStats().worst_lateness, FixedTimestep::Duration::zero());
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,254 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "join_snapshot.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "packets.h"
+
+namespace {
+
+using Buffer = std::vector<std::uint8_t>;
+
+struct SentChunk {
+  Net::ConnectionHandle connection;
+  std::vector<std::uint8_t> bytes;
+};
+
+// Same layout as a serialized ExistingPlayerInfo: player ID, position, then `padding` more bytes.
+std::vector<std::uint8_t> MakeEntry(std::uint32_t player_id, std::size_t padding = 8) {
+  std::vector<std::uint8_t> entry(sizeof(std::uint32_t) + 3 * sizeof(float) + padding, 0);
+  std::memcpy(entry.data(), &player_id, sizeof(player_id));
+  return entry;
+}
+
+// Serialized the way GameServer stores the entries of joined players.
+Buffer SerializeEntry(const ExistingPlayerInfo& info) {
+  Buffer buffer;
+  auto size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<Buffer>>(buffer, info);
+  buffer.resize(size);
+  return buffer;
+}
+
+ExistingPlayerInfo MakeInfo(std::uint32_t player_id, std::string name) {
+  ExistingPlayerInfo info;
+  info.player_id = player_id;
+  info.position = glm::vec3(10.0f * player_id, -5.0f, 2.5f);
+  info.left_hand_item_instance = static_cast<std::int16_t>(100 + player_id);
+  info.right_hand_item_instance = -1;
+  info.equipped_armor_instance = static_cast<std::int16_t>(300 + player_id);
+  info.head_model = 2;
+  info.skin_texture = 7;
+  info.face_texture = static_cast<std::uint8_t>(player_id);
+  info.walk_style = 1;
+  info.player_name = std::move(name);
+  return info;
+}
+
+std::vector<SentChunk> PumpAll(JoinSnapshot& snapshot, std::size_t max_chunks = 1000) {
+  std::vector<SentChunk> sent;
+  snapshot.Pump(max_chunks, [&](Net::ConnectionHandle connection, std::span<const std::uint8_t> chunk) {
+    sent.push_back(SentChunk{connection, std::vector<std::uint8_t>(chunk.begin(), chunk.end())});
+  });
+  return sent;
+}
+
+std::vector<std::uint32_t> PlayerIdsOf(const SentChunk& chunk, std::size_t entry_size) {
+  std::vector<std::uint32_t> player_ids;
+  EXPECT_EQ(chunk.bytes[0], Net::PT_EXISTING_PLAYERS);
+  const std::size_t count = chunk.bytes[1];
+  EXPECT_EQ(chunk.bytes.size(), JoinSnapshot::kChunkHeaderSize + count * entry_size);
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint32_t player_id = 0;
+    std::memcpy(&player_id, chunk.bytes.data() + JoinSnapshot::kChunkHeaderSize + i * entry_size, sizeof(player_id));
+    player_ids.push_back(player_id);
+  }
+  return player_ids;
+}
+
+}  // namespace
+
+TEST(JoinSnapshotTest, StreamsEveryOtherPlayer) {
+  JoinSnapshot snapshot;
+  for (std::uint32_t player_id = 1; player_id <= 3; ++player_id) {
+    snapshot.Update(player_id, MakeEntry(player_id));
+  }
+
+  snapshot.StartStream(42, 2);
+  auto sent = PumpAll(snapshot);
+  ASSERT_EQ(sent.size(), 1u);
+  EXPECT_EQ(sent[0].connection, 42u);
+
+  auto player_ids = PlayerIdsOf(sent[0], MakeEntry(0).size());
+  std::sort(player_ids.begin(), player_ids.end());
+  EXPECT_EQ(player_ids, (std::vector<std::uint32_t>{1, 3}));
+  EXPECT_EQ(snapshot.GetStreamCount(), 0u);
+}
+
+TEST(JoinSnapshotTest, SplitsLargeSnapshotsIntoBoundedChunks) {
+  JoinSnapshot snapshot(200);
+  const std::size_t entry_size = MakeEntry(0).size();
+  for (std::uint32_t player_id = 1; player_id <= 500; ++player_id) {
+    snapshot.Update(player_id, MakeEntry(player_id));
+  }
+
+  snapshot.StartStream(1, 0);
+  auto sent = PumpAll(snapshot);
+  std::size_t total = 0;
+  for (const auto& chunk : sent) {
+    EXPECT_LE(chunk.bytes.size(), 200u);
+    total += PlayerIdsOf(chunk, entry_size).size();
+  }
+  EXPECT_EQ(total, 500u);
+}
+
+TEST(JoinSnapshotTest, ChunkEntryCountFitsASingleSizeByte) {
+  JoinSnapshot snapshot(1 << 20);
+  for (std::uint32_t player_id = 1; player_id <= 300; ++player_id) {
+    snapshot.Update(player_id, MakeEntry(player_id, 0));
+  }
+
+  snapshot.StartStream(1, 0);
+  auto sent = PumpAll(snapshot);
+  ASSERT_EQ(sent.size(), 3u);
+  EXPECT_EQ(sent[0].bytes[1], JoinSnapshot::kMaxChunkEntries);
+  EXPECT_EQ(sent[2].bytes[1], 300 - 2 * JoinSnapshot::kMaxChunkEntries);
+}
+
+TEST(JoinSnapshotTest, PumpIsRateLimitedAndRoundRobin) {
+  JoinSnapshot snapshot(100);
+  for (std::uint32_t player_id = 1; player_id <= 20; ++player_id) {
+    snapshot.Update(player_id, MakeEntry(player_id));
+  }
+  snapshot.StartStream(1, 0);
+  snapshot.StartStream(2, 0);
+
+  auto sent = PumpAll(snapshot, 3);
+  ASSERT_EQ(sent.size(), 3u);
+  EXPECT_EQ(sent[0].connection, 1u);
+  EXPECT_EQ(sent[1].connection, 2u);
+  EXPECT_EQ(sent[2].connection, 1u);
+  EXPECT_EQ(snapshot.GetStreamCount(), 2u);
+}
+
+TEST(JoinSnapshotTest, SkipsPlayersThatLeftDuringTheStream) {
+  JoinSnapshot snapshot;
+  snapshot.Update(1, MakeEntry(1));
+  snapshot.Update(2, MakeEntry(2));
+  snapshot.StartStream(7, 0);
+  snapshot.Remove(1);
+
+  auto sent = PumpAll(snapshot);
+  ASSERT_EQ(sent.size(), 1u);
+  EXPECT_EQ(PlayerIdsOf(sent[0], MakeEntry(0).size()), (std::vector<std::uint32_t>{2}));
+}
+
+TEST(JoinSnapshotTest, CancelledStreamIsNotSent) {
+  JoinSnapshot snapshot;
+  snapshot.Update(1, MakeEntry(1));
+  snapshot.StartStream(7, 0);
+  snapshot.CancelStream(7);
+  EXPECT_TRUE(PumpAll(snapshot).empty());
+}
+
+TEST(JoinSnapshotTest, StreamsOnlyTheRequestedPlayers) {
+  JoinSnapshot snapshot;
+  for (std::uint32_t player_id = 1; player_id <= 5; ++player_id) {
+    snapshot.Update(player_id, MakeEntry(player_id));
+  }
+
+  snapshot.StartStream(7, std::vector<std::uint32_t>{2, 4, 9});
+  EXPECT_TRUE(snapshot.IsStreaming(7));
+
+  auto sent = PumpAll(snapshot);
+  ASSERT_EQ(sent.size(), 1u);
+  EXPECT_EQ(sent[0].connection, 7u);
+  EXPECT_EQ(PlayerIdsOf(sent[0], MakeEntry(0).size()), (std::vector<std::uint32_t>{2, 4}));
+  EXPECT_FALSE(snapshot.IsStreaming(7));
+}
+
+TEST(JoinSnapshotTest, PatchesThePosition) {
+  JoinSnapshot snapshot;
+  snapshot.Update(1, MakeEntry(1));
+  EXPECT_TRUE(snapshot.UpdatePosition(1, glm::vec3(1.0f, 2.0f, 3.0f)));
+  EXPECT_FALSE(snapshot.UpdatePosition(2, glm::vec3(1.0f, 2.0f, 3.0f)));
+
+  snapshot.StartStream(7, 0);
+  auto sent = PumpAll(snapshot);
+  ASSERT_EQ(sent.size(), 1u);
+  float position[3];
+  std::memcpy(position, sent[0].bytes.data() + JoinSnapshot::kChunkHeaderSize + sizeof(std::uint32_t), sizeof(position));
+  EXPECT_EQ(position[0], 1.0f);
+  EXPECT_EQ(position[1], 2.0f);
+  EXPECT_EQ(position[2], 3.0f);
+}
+
+TEST(JoinSnapshotTest, ChunksDecodeAsExistingPlayersPackets) {
+  JoinSnapshot snapshot;
+  std::vector<ExistingPlayerInfo> infos = {MakeInfo(1, "Diego"), MakeInfo(2, "Milten with a somewhat longer name"), MakeInfo(3, "")};
+  for (const auto& info : infos) {
+    snapshot.Update(info.player_id, SerializeEntry(info));
+  }
+  infos[1].position = glm::vec3(-1.5f, 20.0f, 4000.0f);
+  ASSERT_TRUE(snapshot.UpdatePosition(2, infos[1].position));
+
+  snapshot.StartStream(7, std::vector<JoinSnapshot::PlayerId>{1, 2, 3});
+  auto sent = PumpAll(snapshot);
+  ASSERT_EQ(sent.size(), 1u);
+
+  ExistingPlayersPacket packet;
+  auto state = bitsery::quickDeserialization<bitsery::InputBufferAdapter<Buffer>>({sent[0].bytes.begin(), sent[0].bytes.size()}, packet);
+  ASSERT_EQ(state.first, bitsery::ReaderError::NoError);
+  ASSERT_TRUE(state.second);
+
+  EXPECT_EQ(packet.packet_type, Net::PT_EXISTING_PLAYERS);
+  ASSERT_EQ(packet.existing_players.size(), infos.size());
+  for (std::size_t i = 0; i < infos.size(); ++i) {
+    const auto& decoded = packet.existing_players[i];
+    EXPECT_EQ(decoded.player_id, infos[i].player_id);
+    EXPECT_EQ(decoded.position, infos[i].position);
+    EXPECT_EQ(decoded.left_hand_item_instance, infos[i].left_hand_item_instance);
+    EXPECT_EQ(decoded.right_hand_item_instance, infos[i].right_hand_item_instance);
+    EXPECT_EQ(decoded.equipped_armor_instance, infos[i].equipped_armor_instance);
+    EXPECT_EQ(decoded.head_model, infos[i].head_model);
+    EXPECT_EQ(decoded.skin_texture, infos[i].skin_texture);
+    EXPECT_EQ(decoded.face_texture, infos[i].face_texture);
+    EXPECT_EQ(decoded.walk_style, infos[i].walk_style);
+    EXPECT_EQ(decoded.player_name, infos[i].player_name);
+  }
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,72 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "net_streams.h"
+
+namespace {
+
+using namespace Net;
+
+TEST(StreamCountersTest, CountsMessagesAndBytesPerStream) {
+  StreamCounters counters;
+  counters.Record(STREAM_CHAT, 20);
+  counters.Record(STREAM_CHAT, 30);
+  counters.Record(STREAM_COMBAT, 8);
+
+  EXPECT_EQ(counters.Get(STREAM_CHAT).messages, 2u);
+  EXPECT_EQ(counters.Get(STREAM_CHAT).bytes, 50u);
+  EXPECT_EQ(counters.Get(STREAM_COMBAT).messages, 1u);
+  EXPECT_EQ(counters.Get(STREAM_COMBAT).bytes, 8u);
+  EXPECT_EQ(counters.Get(STREAM_MOVEMENT).messages, 0u);
+}
+
+TEST(StreamCountersTest, ChannelsBeyondTheLastStreamFallBackToDefault) {
+  EXPECT_EQ(StreamCounters::Resolve(STREAM_COMBAT), static_cast<std::uint32_t>(STREAM_COMBAT));
+  EXPECT_EQ(StreamCounters::Resolve(kStreamCount - 1), kStreamCount - 1);
+  EXPECT_EQ(StreamCounters::Resolve(kStreamCount), static_cast<std::uint32_t>(STREAM_DEFAULT));
+
+  StreamCounters counters;
+  counters.Record(kStreamCount + 7, 12);
+  EXPECT_EQ(counters.Get(STREAM_DEFAULT).messages, 1u);
+  EXPECT_EQ(counters.Get(STREAM_DEFAULT).bytes, 12u);
+}
+
+TEST(StreamCountersTest, NamesKnownStreams) {
+  EXPECT_STREQ(StreamToString(STREAM_MOVEMENT), "movement");
+  EXPECT_STREQ(StreamToString(STREAM_CHAT), "chat");
+  EXPECT_STREQ(StreamToString(STREAM_COMBAT), "combat");
+  EXPECT_STREQ(StreamToString(3), "unnamed");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
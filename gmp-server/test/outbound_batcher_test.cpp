@@ -0,0 +1,177 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "outbound_batcher.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "message_batch.h"
+
+using namespace Net;
+
+namespace {
+
+struct SentPayload {
+  Net::ConnectionHandle connection;
+  Net::PacketPriority priority;
+  Net::PacketReliability reliability;
+  std::uint32_t channel;
+  std::vector<std::uint8_t> bytes;
+};
+
+std::vector<SentPayload> FlushAll(OutboundBatcher& batcher) {
+  std::vector<SentPayload> sent;
+  batcher.Flush([&](Net::ConnectionHandle connection, Net::PacketPriority priority, Net::PacketReliability reliability, std::uint32_t channel,
+                    std::span<const std::uint8_t> payload) {
+    sent.push_back(SentPayload{connection, priority, reliability, channel, std::vector<std::uint8_t>(payload.begin(), payload.end())});
+  });
+  return sent;
+}
+
+std::vector<std::vector<std::uint8_t>> Unbatch(std::vector<std::uint8_t> batch) {
+  std::vector<std::vector<std::uint8_t>> messages;
+  const bool valid = Net::ForEachBatchedMessage(batch.data(), static_cast<std::uint32_t>(batch.size()), [&](unsigned char* data, std::uint32_t size) {
+    messages.emplace_back(data, data + size);
+  });
+  EXPECT_TRUE(valid);
+  return messages;
+}
+
+}  // namespace
+
+TEST(OutboundBatcherTest, CoalescesMessagesForTheSameConnectionInOrder) {
+  OutboundBatcher batcher;
+  const std::vector<std::uint8_t> first{PT_MSG, 1, 2};
+  const std::vector<std::uint8_t> second{PT_SRVMSG, 3};
+  batcher.Stage(7, LOW_PRIORITY, RELIABLE, 0, first);
+  batcher.Stage(7, HIGH_PRIORITY, RELIABLE, 0, second);
+
+  auto sent = FlushAll(batcher);
+  ASSERT_EQ(sent.size(), 1u);
+  EXPECT_EQ(sent[0].connection, 7u);
+  EXPECT_EQ(sent[0].priority, HIGH_PRIORITY);
+  EXPECT_EQ(sent[0].bytes[0], PT_BATCH);
+
+  auto messages = Unbatch(sent[0].bytes);
+  ASSERT_EQ(messages.size(), 2u);
+  EXPECT_EQ(messages[0], first);
+  EXPECT_EQ(messages[1], second);
+}
+
+TEST(OutboundBatcherTest, SingleMessageIsSentUnwrapped) {
+  OutboundBatcher batcher;
+  const std::vector<std::uint8_t> message{PT_MSG, 1, 2, 3};
+  batcher.Stage(1, MEDIUM_PRIORITY, RELIABLE, 11, message);
+
+  auto sent = FlushAll(batcher);
+  ASSERT_EQ(sent.size(), 1u);
+  EXPECT_EQ(sent[0].bytes, message);
+  EXPECT_EQ(sent[0].channel, 11u);
+}
+
+TEST(OutboundBatcherTest, KeepsConnectionsReliabilitiesAndChannelsApart) {
+  OutboundBatcher batcher;
+  const std::vector<std::uint8_t> message{PT_MSG, 1};
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE, 0, message);
+  batcher.Stage(2, LOW_PRIORITY, RELIABLE, 0, message);
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE_ORDERED, 0, message);
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE, 13, message);
+
+  auto sent = FlushAll(batcher);
+  ASSERT_EQ(sent.size(), 4u);
+  for (const auto& payload : sent) {
+    EXPECT_EQ(payload.bytes, message);
+  }
+  EXPECT_EQ(sent[1].connection, 2u);
+  EXPECT_EQ(sent[2].reliability, RELIABLE_ORDERED);
+  EXPECT_EQ(sent[3].channel, 13u);
+}
+
+TEST(OutboundBatcherTest, StartsANewBatchOnceFull) {
+  OutboundBatcher batcher(16);
+  const std::vector<std::uint8_t> message{PT_MSG, 1, 2, 3, 4};
+  for (int i = 0; i < 5; ++i) {
+    batcher.Stage(1, LOW_PRIORITY, RELIABLE, 0, message);
+  }
+
+  auto sent = FlushAll(batcher);
+  ASSERT_EQ(sent.size(), 3u);
+  std::size_t message_count = 0;
+  for (const auto& payload : sent) {
+    EXPECT_LE(payload.bytes.size(), 16u);
+    message_count += payload.bytes[0] == PT_BATCH ? Unbatch(payload.bytes).size() : 1;
+  }
+  EXPECT_EQ(message_count, 5u);
+}
+
+TEST(OutboundBatcherTest, OversizedMessageIsSentRawAfterEarlierMessages) {
+  OutboundBatcher batcher;
+  const std::vector<std::uint8_t> small{PT_MSG, 1};
+  std::vector<std::uint8_t> large(Net::kMaxBatchedMessageSize + 1, 0);
+  large[0] = PT_MSG;
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE_ORDERED, 0, small);
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE_ORDERED, 0, large);
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE_ORDERED, 0, small);
+
+  auto sent = FlushAll(batcher);
+  ASSERT_EQ(sent.size(), 3u);
+  EXPECT_EQ(sent[0].bytes, small);
+  EXPECT_EQ(sent[1].bytes, large);
+  EXPECT_EQ(sent[2].bytes, small);
+}
+
+TEST(OutboundBatcherTest, RemovedConnectionIsNotFlushed) {
+  OutboundBatcher batcher;
+  const std::vector<std::uint8_t> message{PT_MSG, 1};
+  batcher.Stage(1, LOW_PRIORITY, RELIABLE, 0, message);
+  batcher.Stage(2, LOW_PRIORITY, RELIABLE, 0, message);
+  batcher.RemoveConnection(1);
+
+  auto sent = FlushAll(batcher);
+  ASSERT_EQ(sent.size(), 1u);
+  EXPECT_EQ(sent[0].connection, 2u);
+  EXPECT_TRUE(FlushAll(batcher).empty());
+}
+
+TEST(MessageBatchTest, RejectsMalformedBatches) {
+  auto visit = [](std::vector<std::uint8_t> bytes) {
+    return Net::ForEachBatchedMessage(bytes.data(), static_cast<std::uint32_t>(bytes.size()), [](unsigned char*, std::uint32_t) {});
+  };
+  EXPECT_TRUE(visit({PT_BATCH, 1, 0, PT_MSG}));
+  EXPECT_FALSE(visit({PT_MSG, 1, 0, PT_MSG}));
+  EXPECT_FALSE(visit({PT_BATCH, 5, 0, PT_MSG}));
+  EXPECT_FALSE(visit({PT_BATCH, 0, 0}));
+  EXPECT_FALSE(visit({PT_BATCH, 1}));
+  EXPECT_FALSE(visit({PT_BATCH, 1, 0, PT_BATCH}));
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  return RUN_ALL_TESTS();
+}
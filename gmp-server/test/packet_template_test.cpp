@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "packet_template.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "net_enums.h"
+#include "packets.h"
+
+namespace {
+
+using Buffer = std::vector<std::uint8_t>;
+
+// Serializes whatever `func` writes, the way GameServer encodes the parts of a template.
+template <typename Func>
+Buffer SerializePart(Func&& func) {
+  Buffer buffer;
+  bitsery::Serializer<bitsery::OutputBufferAdapter<Buffer>> serializer{buffer};
+  func(serializer);
+  serializer.adapter().flush();
+  buffer.resize(serializer.adapter().writtenBytesCount());
+  return buffer;
+}
+
+InitialInfoPacket MakeInitialInfo() {
+  InitialInfoPacket packet;
+  packet.packet_type = Net::PT_INITIAL_INFO;
+  packet.map_name = "NEWWORLD\\NEWWORLD.ZEN";
+  packet.player_id = 0x00100007;
+  packet.resource_token = "0123456789abcdef";
+  packet.resume_token = "fedcba9876543210fedcba9876543210";
+  packet.resource_base_path = "/resources";
+  ClientResourceInfoEntry entry;
+  entry.name = "gmp-core";
+  entry.version = "1.2.0";
+  entry.manifest_path = "gmp-core/manifest.json";
+  entry.manifest_sha256 = std::string(64, 'a');
+  entry.archive_path = "gmp-core/archive.zip";
+  entry.archive_sha256 = std::string(64, 'b');
+  entry.archive_size = 123456789;
+  packet.client_resources.push_back(entry);
+  return packet;
+}
+
+}  // namespace
+
+TEST(PacketTemplateTest, AssemblesHeadMiddleAndTail) {
+  PacketTemplate packet_template;
+  EXPECT_FALSE(packet_template.IsValid());
+
+  const std::vector<std::uint8_t> head{1, 2};
+  const std::vector<std::uint8_t> tail{8, 9};
+  packet_template.Set(head, tail);
+  ASSERT_TRUE(packet_template.IsValid());
+
+  std::vector<std::uint8_t> buffer;
+  const std::vector<std::uint8_t> middle{5, 6, 7};
+  auto payload = packet_template.Assemble(middle, buffer);
+  EXPECT_EQ(std::vector<std::uint8_t>(payload.begin(), payload.end()), (std::vector<std::uint8_t>{1, 2, 5, 6, 7, 8, 9}));
+}
+
+TEST(PacketTemplateTest, ReusedBufferIsOnlyGrown) {
+  PacketTemplate packet_template;
+  const std::vector<std::uint8_t> head{1};
+  packet_template.Set(head, {});
+
+  std::vector<std::uint8_t> buffer(64, 0xFF);
+  const std::uint8_t* data = buffer.data();
+  const std::vector<std::uint8_t> middle{2, 3};
+  auto payload = packet_template.Assemble(middle, buffer);
+  EXPECT_EQ(payload.size(), 3u);
+  EXPECT_EQ(payload.data(), data);
+  EXPECT_EQ(buffer.size(), 64u);
+  EXPECT_EQ(std::vector<std::uint8_t>(payload.begin(), payload.end()), (std::vector<std::uint8_t>{1, 2, 3}));
+}
+
+TEST(PacketTemplateTest, InvalidateKeepsTheBytesUntilSetAgain) {
+  PacketTemplate packet_template;
+  const std::vector<std::uint8_t> head{1};
+  const std::vector<std::uint8_t> tail{2};
+  packet_template.Set(head, tail);
+  packet_template.Invalidate();
+  EXPECT_FALSE(packet_template.IsValid());
+
+  std::vector<std::uint8_t> buffer;
+  const std::vector<std::uint8_t> middle{5};
+  auto payload = packet_template.Assemble(middle, buffer);
+  EXPECT_EQ(std::vector<std::uint8_t>(payload.begin(), payload.end()), (std::vector<std::uint8_t>{1, 5, 2}));
+
+  const std::vector<std::uint8_t> new_head{3};
+  packet_template.Set(new_head, {});
+  EXPECT_TRUE(packet_template.IsValid());
+  payload = packet_template.Assemble(middle, buffer);
+  EXPECT_EQ(std::vector<std::uint8_t>(payload.begin(), payload.end()), (std::vector<std::uint8_t>{3, 5}));
+}
+
+TEST(PacketTemplateTest, AssembledInitialInfoMatchesTheWholePacket) {
+  InitialInfoPacket packet = MakeInitialInfo();
+
+  PacketTemplate packet_template;
+  const Buffer head = SerializePart([&](auto& s) { SerializeInitialInfoHead(s, packet); });
+  const Buffer tail = SerializePart([&](auto& s) { SerializeInitialInfoTail(s, packet); });
+  packet_template.Set(head, tail);
+  const Buffer fields = SerializePart([&](auto& s) { SerializeInitialInfoConnectionFields(s, packet); });
+  Buffer buffer;
+  const auto payload = packet_template.Assemble(fields, buffer);
+
+  Buffer whole;
+  const auto whole_size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<Buffer>>(whole, packet);
+  whole.resize(whole_size);
+  EXPECT_EQ(Buffer(payload.begin(), payload.end()), whole);
+
+  InitialInfoPacket decoded;
+  auto state = bitsery::quickDeserialization<bitsery::InputBufferAdapter<Buffer>>({buffer.begin(), payload.size()}, decoded);
+  ASSERT_EQ(state.first, bitsery::ReaderError::NoError);
+  ASSERT_TRUE(state.second);
+  EXPECT_EQ(decoded.packet_type, packet.packet_type);
+  EXPECT_EQ(decoded.map_name, packet.map_name);
+  EXPECT_EQ(decoded.player_id, packet.player_id);
+  EXPECT_EQ(decoded.resource_token, packet.resource_token);
+  EXPECT_EQ(decoded.resume_token, packet.resume_token);
+  EXPECT_EQ(decoded.resource_base_path, packet.resource_base_path);
+  ASSERT_EQ(decoded.client_resources.size(), 1u);
+  EXPECT_EQ(decoded.client_resources[0].name, "gmp-core");
+  EXPECT_EQ(decoded.client_resources[0].archive_sha256, packet.client_resources[0].archive_sha256);
+  EXPECT_EQ(decoded.client_resources[0].archive_size, packet.client_resources[0].archive_size);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "player_history.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace {
+
+using namespace std::chrono_literals;
+using HitCheck = PlayerHistory::HitCheck;
+
+const PlayerHistory::TimePoint kStart{};
+
+PlayerHistory::Sample MakeSample(float x, std::int16_t health = 100) {
+  PlayerHistory::Sample sample;
+  sample.position = glm::vec3(x, 0.0f, 0.0f);
+  sample.health = health;
+  return sample;
+}
+
+// Records `frames` ticks 100 ms apart, player 1 standing at the origin and player 2 walking along X.
+PlayerHistory MakeHistory(std::size_t capacity, std::uint64_t frames) {
+  PlayerHistory history(capacity, 4);
+  for (std::uint64_t tick = 1; tick <= frames; ++tick) {
+    history.BeginFrame(tick, kStart + tick * 100ms);
+    history.Record(1, MakeSample(0.0f));
+    history.Record(2, MakeSample(static_cast<float>(tick) * 100.0f));
+  }
+  return history;
+}
+
+}  // namespace
+
+TEST(PlayerHistoryTest, RewindInterpolatesBetweenFrames) {
+  auto history = MakeHistory(10, 5);
+
+  auto sample = history.Rewind(2, kStart + 250ms);
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_FLOAT_EQ(sample->position.x, 250.0f);
+
+  sample = history.Rewind(2, kStart + 300ms);
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_FLOAT_EQ(sample->position.x, 300.0f);
+}
+
+TEST(PlayerHistoryTest, RewindIsClampedToTheKeptFrames) {
+  auto history = MakeHistory(4, 10);
+
+  // Ticks 7 to 10 are kept.
+  auto sample = history.Rewind(2, kStart);
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_FLOAT_EQ(sample->position.x, 700.0f);
+
+  sample = history.Rewind(2, kStart + 10s);
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_FLOAT_EQ(sample->position.x, 1000.0f);
+}
+
+TEST(PlayerHistoryTest, UnknownPlayerHasNoSample) {
+  auto history = MakeHistory(4, 3);
+  EXPECT_FALSE(history.Rewind(3, kStart + 200ms).has_value());
+  EXPECT_EQ(history.CheckHit(1, 3, kStart + 200ms, 1000.0f), HitCheck::kNoHistory);
+}
+
+TEST(PlayerHistoryTest, FullFrameDropsFurtherPlayers) {
+  PlayerHistory history(2, 1);
+  history.BeginFrame(1, kStart);
+  EXPECT_TRUE(history.Record(1, MakeSample(0.0f)));
+  EXPECT_FALSE(history.Record(2, MakeSample(0.0f)));
+}
+
+TEST(PlayerHistoryTest, CheckHitUsesThePastPositions) {
+  auto history = MakeHistory(10, 10);
+
+  // Player 2 is 1000 units away now, but was within range 700 ms ago.
+  EXPECT_EQ(history.CheckHit(1, 2, kStart + 1000ms, 500.0f), HitCheck::kOutOfRange);
+  EXPECT_EQ(history.CheckHit(1, 2, kStart + 300ms, 500.0f), HitCheck::kValid);
+}
+
+TEST(PlayerHistoryTest, CheckHitRejectsDeadVictims) {
+  PlayerHistory history(4, 4);
+  history.BeginFrame(1, kStart);
+  history.Record(1, MakeSample(0.0f));
+  history.Record(2, MakeSample(10.0f, 0));
+
+  EXPECT_EQ(history.CheckHit(1, 2, kStart, 500.0f), HitCheck::kVictimDead);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
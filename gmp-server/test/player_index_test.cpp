@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "player_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+using PlayerId = PlayerIndex::PlayerId;
+
+std::vector<PlayerId> Sorted(std::vector<PlayerId> players) {
+  std::sort(players.begin(), players.end());
+  return players;
+}
+
+}  // namespace
+
+TEST(PlayerIndexTest, FindsPlayersByNameIgnoringCase) {
+  PlayerIndex index;
+  index.SetName(1, "Xardas");
+  index.SetName(2, "Lester");
+
+  EXPECT_EQ(index.FindByName("xardas"), 1u);
+  EXPECT_EQ(index.FindByName("LESTER"), 2u);
+  EXPECT_FALSE(index.FindByName("Xar").has_value());
+  EXPECT_FALSE(index.FindByName("").has_value());
+}
+
+TEST(PlayerIndexTest, RenamingMovesTheNameEntry) {
+  PlayerIndex index;
+  index.SetName(1, "Nameless");
+  index.SetName(1, "Hero");
+
+  EXPECT_FALSE(index.FindByName("Nameless").has_value());
+  EXPECT_EQ(index.FindByName("hero"), 1u);
+}
+
+TEST(PlayerIndexTest, SharedNamesResolveToTheEarliestHolder) {
+  PlayerIndex index;
+  index.SetName(1, "Gorn");
+  index.SetName(2, "gorn");
+  EXPECT_EQ(index.FindByName("Gorn"), 1u);
+
+  index.RemovePlayer(1);
+  EXPECT_EQ(index.FindByName("Gorn"), 2u);
+}
+
+TEST(PlayerIndexTest, TracksTagMembership) {
+  PlayerIndex index;
+  EXPECT_TRUE(index.AddTag(1, "team_red"));
+  EXPECT_TRUE(index.AddTag(2, "team_red"));
+  EXPECT_TRUE(index.AddTag(2, "admin"));
+  EXPECT_FALSE(index.AddTag(2, "admin"));
+
+  EXPECT_EQ(Sorted(index.GetPlayersWithTag("team_red")), (std::vector<PlayerId>{1, 2}));
+  EXPECT_TRUE(index.HasTag(2, "admin"));
+  EXPECT_TRUE(index.GetPlayersWithTag("team_blue").empty());
+
+  EXPECT_TRUE(index.RemoveTag(1, "team_red"));
+  EXPECT_FALSE(index.RemoveTag(1, "team_red"));
+  EXPECT_EQ(index.GetPlayersWithTag("team_red"), std::vector<PlayerId>{2});
+
+  index.RemovePlayer(2);
+  EXPECT_TRUE(index.GetPlayersWithTag("team_red").empty());
+  EXPECT_FALSE(index.HasTag(2, "admin"));
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
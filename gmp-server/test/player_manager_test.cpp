@@ -0,0 +1,221 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "player_manager.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(PlayerManagerTest, IdsAreNeverZeroAndResolveToTheirPlayer) {
+  PlayerManager manager;
+  const auto first = manager.AddPlayer(100, "first");
+  const auto second = manager.AddPlayer(200, "second");
+
+  EXPECT_NE(first, 0u);
+  EXPECT_NE(second, 0u);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(manager.GetPlayer(first)->get().name, "first");
+  EXPECT_EQ(manager.GetPlayerByConnection(200)->get().player_id, second);
+  EXPECT_EQ(manager.GetConnectionHandle(first), 100u);
+  EXPECT_EQ(manager.GetPlayerId(100), first);
+}
+
+TEST(PlayerManagerTest, StaleIdsDoNotResolveAfterTheSlotIsReused) {
+  PlayerManager manager;
+  const auto stale = manager.AddPlayer(100, "left");
+  ASSERT_TRUE(manager.RemovePlayer(stale));
+
+  const auto reused = manager.AddPlayer(200, "joined");
+  EXPECT_EQ(PlayerManager::GetSlot(reused), PlayerManager::GetSlot(stale));
+  EXPECT_NE(reused, stale);
+
+  EXPECT_FALSE(manager.HasPlayer(stale));
+  EXPECT_FALSE(manager.GetPlayer(stale).has_value());
+  EXPECT_FALSE(manager.GetConnectionHandle(stale).has_value());
+  EXPECT_FALSE(manager.RemovePlayer(stale));
+  EXPECT_TRUE(manager.HasPlayer(reused));
+}
+
+TEST(PlayerManagerTest, RemovingKeepsTheOtherPlayersReachable) {
+  PlayerManager manager;
+  std::vector<PlayerManager::PlayerId> ids;
+  for (Net::ConnectionHandle connection = 1; connection <= 5; ++connection) {
+    ids.push_back(manager.AddPlayer(connection, std::to_string(connection)));
+  }
+
+  ASSERT_TRUE(manager.RemovePlayerByConnection(2));
+  ASSERT_TRUE(manager.RemovePlayer(ids[0]));
+
+  EXPECT_EQ(manager.GetPlayerCount(), 3u);
+  EXPECT_FALSE(manager.HasConnection(2));
+  for (std::size_t i = 2; i < ids.size(); ++i) {
+    auto player = manager.GetPlayer(ids[i]);
+    ASSERT_TRUE(player.has_value());
+    EXPECT_EQ(player->get().name, std::to_string(i + 1));
+    EXPECT_EQ(manager.GetPlayerId(i + 1), ids[i]);
+  }
+}
+
+TEST(PlayerManagerTest, IteratesOnlyIngamePlayers) {
+  PlayerManager manager;
+  const auto ingame = manager.AddPlayer(1, "ingame");
+  manager.AddPlayer(2, "joining");
+  ASSERT_TRUE(manager.SetIngame(ingame, true));
+
+  std::set<PlayerManager::PlayerId> visited;
+  manager.ForEachIngamePlayer([&](const PlayerManager::Player& player) { visited.insert(player.player_id); });
+  EXPECT_EQ(visited, std::set<PlayerManager::PlayerId>{ingame});
+
+  std::size_t count = 0;
+  manager.ForEachPlayer([&](const PlayerManager::Player&) { ++count; });
+  EXPECT_EQ(count, 2u);
+}
+
+TEST(PlayerManagerTest, IngameIterationFollowsMovedPlayers) {
+  PlayerManager manager;
+  std::vector<PlayerManager::PlayerId> ids;
+  for (Net::ConnectionHandle connection = 1; connection <= 4; ++connection) {
+    ids.push_back(manager.AddPlayer(connection, std::to_string(connection)));
+    ASSERT_TRUE(manager.SetIngame(ids.back(), true));
+  }
+
+  // Removing the first player moves the last one into its place.
+  ASSERT_TRUE(manager.RemovePlayer(ids[0]));
+  ASSERT_TRUE(manager.SetIngame(ids[2], false));
+
+  std::set<std::string> visited;
+  manager.ForEachIngamePlayer([&](const PlayerManager::Player& player) {
+    EXPECT_TRUE(player.is_ingame);
+    visited.insert(player.name);
+  });
+  EXPECT_EQ(visited, (std::set<std::string>{"2", "4"}));
+}
+
+TEST(PlayerManagerTest, IndexesFollowRenamesAndLeaves) {
+  PlayerManager manager;
+  const auto id = manager.AddPlayer(1, "");
+  ASSERT_TRUE(manager.SetPlayerName(id, "Diego"));
+  ASSERT_TRUE(manager.SetIngame(id, true));
+  ASSERT_TRUE(manager.AddTag(id, "old_camp"));
+
+  EXPECT_EQ(manager.FindPlayerByName("diego"), id);
+  EXPECT_EQ(manager.GetIndex().GetPlayersWithTag("old_camp"), std::vector<PlayerManager::PlayerId>{id});
+  EXPECT_EQ(manager.GetIngameIds(), std::vector<PlayerManager::PlayerId>{id});
+
+  ASSERT_TRUE(manager.RemovePlayer(id));
+  EXPECT_FALSE(manager.FindPlayerByName("Diego").has_value());
+  EXPECT_TRUE(manager.GetIndex().GetPlayersWithTag("old_camp").empty());
+  EXPECT_TRUE(manager.GetIngameIds().empty());
+  EXPECT_FALSE(manager.AddTag(id, "old_camp"));
+  EXPECT_FALSE(manager.SetPlayerName(id, "Diego"));
+}
+
+TEST(PlayerManagerTest, IngameColumnsFollowPositionsAndLeaves) {
+  PlayerManager manager;
+  const auto first = manager.AddPlayer(1, "");
+  const auto second = manager.AddPlayer(2, "");
+  const auto third = manager.AddPlayer(3, "");
+  ASSERT_TRUE(manager.SetPosition(first, {1.0f, 0.0f, 0.0f}));
+  ASSERT_TRUE(manager.SetIngame(first, true));
+  ASSERT_TRUE(manager.SetIngame(second, true));
+  ASSERT_TRUE(manager.SetIngame(third, true));
+  ASSERT_TRUE(manager.SetIngame(third, true));
+  EXPECT_EQ(manager.GetIngameIds(), (std::vector<PlayerManager::PlayerId>{first, second, third}));
+  EXPECT_EQ(manager.GetIngamePosition(first), glm::vec3(1.0f, 0.0f, 0.0f));
+
+  PlayerState state;
+  state.position = {3.0f, 0.0f, 0.0f};
+  ASSERT_TRUE(manager.SetState(third, state));
+  ASSERT_TRUE(manager.SetPosition(second, {2.0f, 0.0f, 0.0f}));
+
+  // The last in-game player takes the place of the one leaving, in every column.
+  ASSERT_TRUE(manager.SetIngame(first, false));
+  EXPECT_EQ(manager.GetIngameIds(), (std::vector<PlayerManager::PlayerId>{third, second}));
+  EXPECT_EQ(manager.GetIngamePositions(), (std::vector<glm::vec3>{{3.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}}));
+  EXPECT_FALSE(manager.GetIngamePosition(first).has_value());
+
+  // Players out of the game are only moved in their record.
+  ASSERT_TRUE(manager.SetPosition(first, {4.0f, 0.0f, 0.0f}));
+  EXPECT_EQ(manager.GetPlayer(first)->get().state.position, glm::vec3(4.0f, 0.0f, 0.0f));
+  EXPECT_EQ(manager.GetIngamePositions().size(), 2u);
+
+  ASSERT_TRUE(manager.RemovePlayer(third));
+  EXPECT_EQ(manager.GetIngameIds(), std::vector<PlayerManager::PlayerId>{second});
+  EXPECT_EQ(manager.GetIngamePosition(second), glm::vec3(2.0f, 0.0f, 0.0f));
+  EXPECT_FALSE(manager.SetPosition(third, {}));
+}
+
+TEST(PlayerManagerTest, DetachedPlayersCanBeAttachedToANewConnection) {
+  PlayerManager manager;
+  const auto id = manager.AddPlayer(1, "player");
+  ASSERT_TRUE(manager.DetachConnection(id));
+  EXPECT_FALSE(manager.HasConnection(1));
+  EXPECT_TRUE(manager.HasPlayer(id));
+
+  // The reconnecting client gets a placeholder first, which gives way to the resumed player.
+  const auto placeholder = manager.AddPlayer(2, "");
+  ASSERT_TRUE(manager.RemovePlayer(placeholder));
+  ASSERT_TRUE(manager.AttachConnection(id, 2));
+
+  EXPECT_EQ(manager.GetPlayerId(2), id);
+  EXPECT_EQ(manager.GetConnectionHandle(id), 2u);
+  EXPECT_FALSE(manager.HasConnection(1));
+}
+
+TEST(PlayerManagerTest, DetachedPlayerDoesNotTakeItsHandleFromTheNextOwner) {
+  PlayerManager manager;
+  const auto suspended = manager.AddPlayer(1, "");
+  ASSERT_TRUE(manager.DetachConnection(suspended));
+  const auto newcomer = manager.AddPlayer(1, "");
+
+  ASSERT_TRUE(manager.RemovePlayer(suspended));
+  EXPECT_EQ(manager.GetPlayerId(1), newcomer);
+}
+
+TEST(PlayerManagerTest, GenerationsWrapWithoutProducingIdZero) {
+  PlayerManager manager;
+  const auto first = manager.AddPlayer(1, "");
+  manager.RemovePlayer(first);
+
+  std::set<PlayerManager::PlayerId> seen{first};
+  const std::uint32_t generations = 1u << (32 - PlayerManager::kSlotBits);
+  for (std::uint32_t i = 0; i < generations; ++i) {
+    const auto id = manager.AddPlayer(1, "");
+    EXPECT_NE(id, 0u);
+    EXPECT_NE(PlayerManager::GetGeneration(id), 0u);
+    seen.insert(id);
+    manager.RemovePlayer(id);
+  }
+  // Every generation but 0 was handed out before the first one came around again.
+  EXPECT_EQ(seen.size(), generations - 1);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
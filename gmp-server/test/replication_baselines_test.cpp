@@ -0,0 +1,135 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "replication_baselines.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr std::uint32_t kInterval = 10;
+
+PlayerState MakeState(float x, std::int16_t animation) {
+  PlayerState state;
+  state.position = glm::vec3(x, 0.0f, 0.0f);
+  state.animation = animation;
+  return state;
+}
+
+}  // namespace
+
+TEST(ReplicationBaselinesTest, KeyframeIsKeptUntilIntervalElapses) {
+  ReplicationBaselines baselines(kInterval);
+
+  const auto& first = baselines.RefreshKeyframe(1, MakeState(1.0f, 1), 100);
+  EXPECT_EQ(first.tick, 100u);
+  EXPECT_EQ(first.sequence, 0);
+
+  const auto& same = baselines.RefreshKeyframe(1, MakeState(2.0f, 1), 100 + kInterval - 1);
+  EXPECT_EQ(same.tick, 100u);
+  EXPECT_EQ(same.state.position.x, 1.0f);
+
+  const auto& next = baselines.RefreshKeyframe(1, MakeState(3.0f, 1), 100 + kInterval);
+  EXPECT_EQ(next.tick, 100u + kInterval);
+  EXPECT_EQ(next.sequence, 1);
+  EXPECT_EQ(next.state.position.x, 3.0f);
+}
+
+TEST(ReplicationBaselinesTest, KeyframeIsSentOncePerRecipient) {
+  ReplicationBaselines baselines(kInterval);
+  baselines.RefreshKeyframe(1, MakeState(1.0f, 1), 0);
+
+  EXPECT_TRUE(baselines.NeedsKeyframe(2, 1));
+  EXPECT_TRUE(baselines.MarkKeyframeSent(2, 1));
+  EXPECT_FALSE(baselines.NeedsKeyframe(2, 1));
+  EXPECT_FALSE(baselines.MarkKeyframeSent(2, 1));
+  EXPECT_TRUE(baselines.MarkKeyframeSent(3, 1));
+
+  baselines.RefreshKeyframe(1, MakeState(2.0f, 1), kInterval);
+  EXPECT_TRUE(baselines.NeedsKeyframe(2, 1));
+  EXPECT_TRUE(baselines.MarkKeyframeSent(2, 1));
+  EXPECT_FALSE(baselines.MarkKeyframeSent(2, 1));
+}
+
+TEST(ReplicationBaselinesTest, UnknownSubjectHasNoKeyframe) {
+  ReplicationBaselines baselines(kInterval);
+  EXPECT_FALSE(baselines.MarkKeyframeSent(2, 1));
+}
+
+TEST(ReplicationBaselinesTest, RemovedPlayerStartsOver) {
+  ReplicationBaselines baselines(kInterval);
+  baselines.RefreshKeyframe(1, MakeState(1.0f, 1), 0);
+  baselines.RefreshKeyframe(1, MakeState(1.0f, 1), kInterval);
+  EXPECT_TRUE(baselines.MarkKeyframeSent(2, 1));
+
+  baselines.RemovePlayer(1);
+
+  const auto& keyframe = baselines.RefreshKeyframe(1, MakeState(5.0f, 1), kInterval + 1);
+  EXPECT_EQ(keyframe.sequence, 0);
+  EXPECT_TRUE(baselines.MarkKeyframeSent(2, 1));
+}
+
+TEST(ReplicationBaselinesTest, ShardsTrackRecipientsIndependently) {
+  ReplicationBaselines baselines(kInterval, 4);
+  EXPECT_EQ(baselines.GetShardCount(), 4u);
+  baselines.RefreshKeyframe(1, MakeState(1.0f, 1), 0);
+
+  // Recipients 2 and 6 share a shard, 3 lives in another one.
+  EXPECT_TRUE(baselines.MarkKeyframeSent(2, 1));
+  EXPECT_TRUE(baselines.NeedsKeyframe(6, 1));
+  EXPECT_TRUE(baselines.NeedsKeyframe(3, 1));
+  EXPECT_TRUE(baselines.MarkKeyframeSent(3, 1));
+  EXPECT_FALSE(baselines.NeedsKeyframe(2, 1));
+
+  baselines.RemovePlayer(2);
+  EXPECT_TRUE(baselines.NeedsKeyframe(2, 1));
+  EXPECT_FALSE(baselines.NeedsKeyframe(3, 1));
+}
+
+TEST(PlayerStateDeltaTest, OnlyChangedFieldsAreFlagged) {
+  PlayerState baseline = MakeState(1.0f, 10);
+  PlayerState current = baseline;
+  current.position.x = 2.0f;
+  current.weapon_mode = 3;
+
+  auto delta = MakePlayerStateDelta(baseline, current);
+  EXPECT_EQ(delta.changed_fields, kPlayerStatePosition | kPlayerStateWeaponMode);
+
+  PlayerState applied = baseline;
+  ApplyPlayerStateDelta(delta, applied);
+  EXPECT_EQ(applied.position.x, 2.0f);
+  EXPECT_EQ(applied.weapon_mode, 3);
+  EXPECT_EQ(applied.animation, 10);
+}
+
+TEST(PlayerStateDeltaTest, IdenticalStatesProduceEmptyDelta) {
+  PlayerState state = MakeState(1.0f, 10);
+  EXPECT_EQ(MakePlayerStateDelta(state, state).changed_fields, 0);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
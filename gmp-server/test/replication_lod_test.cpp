@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "replication_lod.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+ReplicationLod MakeLod() {
+  ReplicationLod::Settings settings;
+  settings.near_radius = 1500.0f;
+  settings.mid_radius = 5000.0f;
+  settings.mid_interval_ticks = 2;
+  settings.far_interval_ticks = 10;
+  return ReplicationLod(settings);
+}
+
+}  // namespace
+
+TEST(ReplicationLodTest, ClassifiesByHorizontalDistance) {
+  auto lod = MakeLod();
+  const glm::vec3 origin(0.0f, 0.0f, 0.0f);
+
+  EXPECT_EQ(lod.Classify(origin, glm::vec3(1000.0f, 0.0f, 1000.0f)), ReplicationLod::Tier::kNear);
+  EXPECT_EQ(lod.Classify(origin, glm::vec3(0.0f, 9000.0f, 1500.0f)), ReplicationLod::Tier::kNear);
+  EXPECT_EQ(lod.Classify(origin, glm::vec3(3000.0f, 0.0f, 3000.0f)), ReplicationLod::Tier::kMid);
+  EXPECT_EQ(lod.Classify(origin, glm::vec3(-5000.0f, 0.0f, 0.0f)), ReplicationLod::Tier::kMid);
+  EXPECT_EQ(lod.Classify(origin, glm::vec3(4000.0f, 0.0f, -4000.0f)), ReplicationLod::Tier::kFar);
+}
+
+TEST(ReplicationLodTest, NearTierIsDueEveryTick) {
+  auto lod = MakeLod();
+  for (std::uint64_t tick = 0; tick < 20; ++tick) {
+    EXPECT_TRUE(lod.IsDue(ReplicationLod::Tier::kNear, 1, 2, tick));
+  }
+}
+
+TEST(ReplicationLodTest, EachPairIsDueOncePerInterval) {
+  auto lod = MakeLod();
+  for (std::uint32_t subject = 0; subject < 50; ++subject) {
+    int due_count = 0;
+    for (std::uint64_t tick = 100; tick < 110; ++tick) {
+      due_count += lod.IsDue(ReplicationLod::Tier::kFar, 7, subject, tick) ? 1 : 0;
+    }
+    EXPECT_EQ(due_count, 1) << "subject " << subject;
+  }
+}
+
+TEST(ReplicationLodTest, PhasesSpreadAcrossTicks) {
+  auto lod = MakeLod();
+  std::vector<int> due_per_tick(10, 0);
+  for (std::uint32_t recipient = 0; recipient < 40; ++recipient) {
+    for (std::uint32_t subject = 0; subject < 40; ++subject) {
+      for (std::uint64_t tick = 0; tick < 10; ++tick) {
+        due_per_tick[tick] += lod.IsDue(ReplicationLod::Tier::kFar, recipient, subject, tick) ? 1 : 0;
+      }
+    }
+  }
+
+  // 1600 pairs over 10 ticks, none of the ticks should carry much more than its share of 160.
+  for (int count : due_per_tick) {
+    EXPECT_GT(count, 100);
+    EXPECT_LT(count, 220);
+  }
+}
+
+TEST(ReplicationLodTest, InvalidSettingsAreSanitized) {
+  ReplicationLod::Settings settings;
+  settings.near_radius = 3000.0f;
+  settings.mid_radius = 1000.0f;
+  settings.mid_interval_ticks = 0;
+  settings.far_interval_ticks = 0;
+  ReplicationLod lod(settings);
+
+  EXPECT_EQ(lod.GetRelevanceRadius(), 3000.0f);
+  EXPECT_EQ(lod.GetInterval(ReplicationLod::Tier::kMid), 1u);
+  EXPECT_EQ(lod.GetInterval(ReplicationLod::Tier::kFar), 1u);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
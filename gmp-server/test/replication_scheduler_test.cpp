@@ -0,0 +1,158 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "replication_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using Payload = ReplicationScheduler::Payload;
+using PlayerId = ReplicationScheduler::PlayerId;
+
+constexpr PlayerId kRecipient = 1;
+
+std::vector<PlayerId> Send(ReplicationScheduler& scheduler) {
+  std::vector<PlayerId> sent;
+  scheduler.SendSelected([&](PlayerId subject_id, Payload) { sent.push_back(subject_id); });
+  return sent;
+}
+
+}  // namespace
+
+TEST(ReplicationSchedulerTest, UnlimitedBudgetSendsEverything) {
+  ReplicationScheduler scheduler(0);
+  scheduler.BeginRecipient(kRecipient);
+  for (PlayerId subject = 10; subject < 20; ++subject) {
+    scheduler.AddCandidate(subject, Payload::kState, 1000, 1.0f);
+  }
+
+  EXPECT_EQ(Send(scheduler).size(), 10u);
+}
+
+TEST(ReplicationSchedulerTest, HighestPriorityFirstWithinBudget) {
+  ReplicationScheduler scheduler(100);
+  scheduler.BeginRecipient(kRecipient);
+  scheduler.AddCandidate(10, Payload::kState, 50, 0.5f);
+  scheduler.AddCandidate(11, Payload::kState, 50, 2.0f);
+  scheduler.AddCandidate(12, Payload::kState, 50, 1.0f);
+
+  EXPECT_EQ(Send(scheduler), (std::vector<PlayerId>{11, 12}));
+  EXPECT_TRUE(scheduler.IsCarriedOver(10));
+  EXPECT_FALSE(scheduler.IsCarriedOver(11));
+}
+
+TEST(ReplicationSchedulerTest, SmallerCandidatesFillRemainingBudget) {
+  ReplicationScheduler scheduler(100);
+  scheduler.BeginRecipient(kRecipient);
+  scheduler.AddCandidate(10, Payload::kState, 80, 3.0f);
+  scheduler.AddCandidate(11, Payload::kState, 40, 2.0f);
+  scheduler.AddCandidate(12, Payload::kMapOnly, 20, 1.0f);
+
+  EXPECT_EQ(Send(scheduler), (std::vector<PlayerId>{10, 12}));
+}
+
+TEST(ReplicationSchedulerTest, OversizedTopCandidateIsStillSent) {
+  ReplicationScheduler scheduler(10);
+  scheduler.BeginRecipient(kRecipient);
+  scheduler.AddCandidate(10, Payload::kState, 50, 1.0f);
+
+  EXPECT_EQ(Send(scheduler), (std::vector<PlayerId>{10}));
+}
+
+TEST(ReplicationSchedulerTest, CarriedOverPriorityAccumulatesUntilSent) {
+  ReplicationScheduler scheduler(50);
+
+  // Subject 10 gains less per tick, but its priority keeps growing while it waits.
+  std::vector<PlayerId> sent_order;
+  for (int tick = 0; tick < 4; ++tick) {
+    scheduler.BeginRecipient(kRecipient);
+    scheduler.AddCandidate(10, Payload::kState, 50, 0.6f);
+    scheduler.AddCandidate(11, Payload::kState, 50, 1.0f);
+    auto sent = Send(scheduler);
+    ASSERT_EQ(sent.size(), 1u);
+    sent_order.push_back(sent[0]);
+  }
+
+  EXPECT_EQ(sent_order, (std::vector<PlayerId>{11, 10, 11, 10}));
+}
+
+TEST(ReplicationSchedulerTest, PairsArePerRecipient) {
+  ReplicationScheduler scheduler(50);
+  scheduler.BeginRecipient(1);
+  scheduler.AddCandidate(10, Payload::kState, 50, 1.0f);
+  scheduler.AddCandidate(11, Payload::kState, 50, 2.0f);
+  Send(scheduler);
+
+  scheduler.BeginRecipient(2);
+  EXPECT_FALSE(scheduler.IsCarriedOver(10));
+
+  scheduler.BeginRecipient(1);
+  EXPECT_TRUE(scheduler.IsCarriedOver(10));
+
+  scheduler.RemovePlayer(10);
+  scheduler.BeginRecipient(1);
+  EXPECT_FALSE(scheduler.IsCarriedOver(10));
+}
+
+TEST(ReplicationSchedulerTest, StateWeightFavorsCloseAndChangingPlayers) {
+  EXPECT_GT(ReplicationScheduler::StateWeight(100.0f, 0), ReplicationScheduler::StateWeight(4000.0f, 0));
+  EXPECT_GT(ReplicationScheduler::StateWeight(1000.0f, 3), ReplicationScheduler::StateWeight(1000.0f, 1));
+  EXPECT_GT(ReplicationScheduler::StateWeight(5000.0f, 0), ReplicationScheduler::kMapOnlyWeight);
+}
+
+TEST(ReplicationSchedulerTest, SentRevisionsAreTrackedPerPayload) {
+  ReplicationScheduler scheduler(0);
+  scheduler.BeginRecipient(kRecipient);
+  EXPECT_FALSE(scheduler.IsUpToDate(10, Payload::kState, 1));
+
+  scheduler.AddCandidate(10, Payload::kMapOnly, 10, 1.0f, 1);
+  Send(scheduler);
+
+  scheduler.BeginRecipient(kRecipient);
+  EXPECT_TRUE(scheduler.IsUpToDate(10, Payload::kMapOnly, 1));
+  EXPECT_FALSE(scheduler.IsUpToDate(10, Payload::kState, 1));
+  EXPECT_FALSE(scheduler.IsUpToDate(10, Payload::kMapOnly, 2));
+}
+
+TEST(ReplicationSchedulerTest, CarriedOverRevisionIsNotUpToDate) {
+  ReplicationScheduler scheduler(10);
+  scheduler.BeginRecipient(kRecipient);
+  scheduler.AddCandidate(10, Payload::kState, 10, 2.0f, 3);
+  scheduler.AddCandidate(11, Payload::kState, 10, 1.0f, 3);
+  Send(scheduler);
+
+  scheduler.BeginRecipient(kRecipient);
+  EXPECT_TRUE(scheduler.IsUpToDate(10, Payload::kState, 3));
+  EXPECT_FALSE(scheduler.IsUpToDate(11, Payload::kState, 3));
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
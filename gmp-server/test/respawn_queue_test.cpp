@@ -0,0 +1,102 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "respawn_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+using PlayerId = RespawnQueue::PlayerId;
+
+const RespawnQueue::TimePoint kStart{};
+
+std::vector<PlayerId> PopDue(RespawnQueue& queue, RespawnQueue::TimePoint now) {
+  std::vector<PlayerId> due;
+  queue.PopDue(now, [&](PlayerId player_id) { due.push_back(player_id); });
+  return due;
+}
+
+}  // namespace
+
+TEST(RespawnQueueTest, PlayersRespawnInDeadlineOrder) {
+  RespawnQueue queue;
+  queue.Schedule(1, kStart + 300ms);
+  queue.Schedule(2, kStart + 100ms);
+  queue.Schedule(3, kStart + 200ms);
+
+  EXPECT_TRUE(PopDue(queue, kStart + 50ms).empty());
+  EXPECT_EQ(PopDue(queue, kStart + 250ms), (std::vector<PlayerId>{2, 3}));
+  EXPECT_EQ(PopDue(queue, kStart + 1s), (std::vector<PlayerId>{1}));
+  EXPECT_EQ(queue.GetScheduledCount(), 0u);
+  EXPECT_FALSE(queue.GetNextDeadline().has_value());
+}
+
+TEST(RespawnQueueTest, SubSecondDelaysAreKept) {
+  RespawnQueue queue;
+  queue.Schedule(1, kStart + 1500ms);
+
+  EXPECT_TRUE(PopDue(queue, kStart + 1499ms).empty());
+  EXPECT_EQ(PopDue(queue, kStart + 1500ms), (std::vector<PlayerId>{1}));
+}
+
+TEST(RespawnQueueTest, CancelledPlayerIsSkipped) {
+  RespawnQueue queue;
+  queue.Schedule(1, kStart + 100ms);
+  queue.Schedule(2, kStart + 100ms);
+
+  EXPECT_TRUE(queue.Cancel(1));
+  EXPECT_FALSE(queue.Cancel(1));
+  EXPECT_FALSE(queue.IsScheduled(1));
+  EXPECT_EQ(PopDue(queue, kStart + 1s), (std::vector<PlayerId>{2}));
+}
+
+TEST(RespawnQueueTest, RescheduleReplacesTheEarlierDeadline) {
+  RespawnQueue queue;
+  queue.Schedule(1, kStart + 100ms);
+  queue.Schedule(1, kStart + 500ms);
+  EXPECT_EQ(queue.GetScheduledCount(), 1u);
+
+  EXPECT_TRUE(PopDue(queue, kStart + 200ms).empty());
+  EXPECT_EQ(PopDue(queue, kStart + 500ms), (std::vector<PlayerId>{1}));
+}
+
+TEST(RespawnQueueTest, EqualDeadlinesKeepSchedulingOrder) {
+  RespawnQueue queue;
+  queue.Schedule(5, kStart + 100ms);
+  queue.Schedule(2, kStart + 100ms);
+  queue.Schedule(9, kStart + 100ms);
+
+  EXPECT_EQ(PopDue(queue, kStart + 100ms), (std::vector<PlayerId>{5, 2, 9}));
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
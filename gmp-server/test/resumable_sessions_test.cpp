@@ -0,0 +1,149 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "resumable_sessions.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+using PlayerId = ResumableSessions::PlayerId;
+
+const ResumableSessions::TimePoint kStart{};
+
+}  // namespace
+
+TEST(ResumableSessionsTest, ResumesASuspendedSessionWithinTheGracePeriod) {
+  ResumableSessions sessions(10s);
+  const auto token = sessions.IssueToken(1);
+  EXPECT_FALSE(token.empty());
+
+  ASSERT_TRUE(sessions.Suspend(1, {2, 3}, kStart));
+  EXPECT_TRUE(sessions.IsSuspended(1));
+
+  auto session = sessions.Resume(token, kStart + 9s);
+  ASSERT_TRUE(session.has_value());
+  EXPECT_EQ(session->player_id, 1u);
+  EXPECT_EQ(session->known_players, (std::vector<PlayerId>{2, 3}));
+  EXPECT_FALSE(sessions.IsSuspended(1));
+  EXPECT_EQ(sessions.GetSuspendedCount(), 0u);
+}
+
+TEST(ResumableSessionsTest, TokensWorkOnlyOnce) {
+  ResumableSessions sessions(10s);
+  const auto token = sessions.IssueToken(1);
+  ASSERT_TRUE(sessions.Suspend(1, {}, kStart));
+  ASSERT_TRUE(sessions.Resume(token, kStart).has_value());
+
+  // Without the new token handed out on resume there is nothing to suspend with.
+  EXPECT_FALSE(sessions.Suspend(1, {}, kStart));
+  sessions.IssueToken(1);
+  ASSERT_TRUE(sessions.Suspend(1, {}, kStart));
+  EXPECT_FALSE(sessions.Resume(token, kStart).has_value());
+}
+
+TEST(ResumableSessionsTest, ConnectedPlayersCannotBeTakenOver) {
+  ResumableSessions sessions(10s);
+  const auto token = sessions.IssueToken(1);
+
+  EXPECT_FALSE(sessions.Resume(token, kStart).has_value());
+  EXPECT_FALSE(sessions.Resume("", kStart).has_value());
+  EXPECT_FALSE(sessions.Resume("unknown", kStart).has_value());
+}
+
+TEST(ResumableSessionsTest, TamperedTokensAreRejected) {
+  ResumableSessions sessions(10s);
+  const auto token = sessions.IssueToken(1);
+  const auto other_token = sessions.IssueToken(2);
+  ASSERT_TRUE(sessions.Suspend(1, {}, kStart));
+  ASSERT_TRUE(sessions.Suspend(2, {}, kStart));
+
+  // The right player ID with a wrong secret, and the other way around.
+  auto wrong_secret = token;
+  wrong_secret.back() = wrong_secret.back() == '0' ? '1' : '0';
+  EXPECT_FALSE(sessions.Resume(wrong_secret, kStart).has_value());
+  EXPECT_FALSE(sessions.Resume(other_token.substr(0, 8) + token.substr(8), kStart).has_value());
+  EXPECT_FALSE(sessions.Resume(token.substr(0, token.size() - 1), kStart).has_value());
+
+  EXPECT_TRUE(sessions.IsSuspended(1));
+  EXPECT_TRUE(sessions.Resume(token, kStart).has_value());
+}
+
+TEST(ResumableSessionsTest, ReissuingReplacesTheToken) {
+  ResumableSessions sessions(10s);
+  const auto old_token = sessions.IssueToken(1);
+  const auto new_token = sessions.IssueToken(1);
+  EXPECT_NE(old_token, new_token);
+  ASSERT_TRUE(sessions.Suspend(1, {}, kStart));
+
+  EXPECT_FALSE(sessions.Resume(old_token, kStart).has_value());
+  EXPECT_TRUE(sessions.Resume(new_token, kStart).has_value());
+}
+
+TEST(ResumableSessionsTest, ExpiredSessionsAreReportedAndForgotten) {
+  ResumableSessions sessions(10s);
+  const auto token = sessions.IssueToken(1);
+  sessions.IssueToken(2);
+  ASSERT_TRUE(sessions.Suspend(1, {}, kStart));
+  ASSERT_TRUE(sessions.Suspend(2, {}, kStart + 5s));
+
+  std::vector<PlayerId> expired;
+  sessions.ExpireDue(kStart + 10s, [&](PlayerId player_id) { expired.push_back(player_id); });
+  EXPECT_EQ(expired, std::vector<PlayerId>{1});
+  EXPECT_FALSE(sessions.Resume(token, kStart + 10s).has_value());
+  EXPECT_TRUE(sessions.IsSuspended(2));
+  EXPECT_EQ(sessions.GetSuspendedCount(), 1u);
+}
+
+TEST(ResumableSessionsTest, DisabledWithoutAGracePeriod) {
+  ResumableSessions sessions(0s);
+  EXPECT_FALSE(sessions.IsEnabled());
+  EXPECT_TRUE(sessions.IssueToken(1).empty());
+  EXPECT_FALSE(sessions.Suspend(1, {}, kStart));
+}
+
+TEST(ResumableSessionsTest, DisabledByDefault) {
+  ResumableSessions sessions;
+  EXPECT_FALSE(sessions.IsEnabled());
+  EXPECT_TRUE(sessions.IssueToken(1).empty());
+}
+
+TEST(ResumableSessionsTest, ForgottenPlayersCannotBeSuspended) {
+  ResumableSessions sessions(10s);
+  const auto token = sessions.IssueToken(1);
+  sessions.Forget(1);
+
+  EXPECT_FALSE(sessions.Suspend(1, {}, kStart));
+  EXPECT_FALSE(sessions.Resume(token, kStart).has_value());
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,243 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "send_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "outbound_batcher.h"
+#include "outbound_queue.h"
+#include "worker_pool.h"
+#include "znet_server.h"
+
+// Counts every heap allocation of the process, which is the hook the steady state tests below
+// measure the send path with.
+namespace {
+std::atomic<std::size_t> g_allocation_count{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+namespace {
+
+using namespace Net;
+
+class CountingNetServer : public Net::NetServer {
+public:
+  void Pulse() override {
+  }
+  bool WaitForPackets(std::uint32_t) override {
+    return false;
+  }
+  bool Start(std::uint32_t, std::uint32_t) override {
+    return true;
+  }
+  bool Send(unsigned char*, std::uint32_t size, PacketPriority, PacketReliability, std::uint32_t, ConnectionHandle) override {
+    sent_bytes += size;
+    return true;
+  }
+  bool Send(const char*, std::uint32_t size, PacketPriority, PacketReliability, std::uint32_t, ConnectionHandle) override {
+    sent_bytes += size;
+    return true;
+  }
+  bool Send(std::span<const std::uint8_t> data, PacketPriority, PacketReliability, std::uint32_t, ConnectionHandle) override {
+    sent_bytes += data.size();
+    return true;
+  }
+  StreamStats GetStreamStats(std::uint32_t) const override {
+    return {};
+  }
+  void AddToBanList(const char*, std::uint32_t) override {
+  }
+  void AddToBanList(ConnectionHandle, std::uint32_t) override {
+  }
+  void RemoveFromBanList(const char*) override {
+  }
+  bool IsBanned(const char*) override {
+    return false;
+  }
+  const char* GetPlayerIp(ConnectionHandle) override {
+    return "127.0.0.1";
+  }
+  std::int32_t GetAveragePing(ConnectionHandle) override {
+    return -1;
+  }
+  void AddPacketHandler(PacketHandler&) override {
+  }
+  void RemovePacketHandler(PacketHandler&) override {
+  }
+  std::uint32_t GetPort() const override {
+    return 0;
+  }
+  std::string GetAddress() const override {
+    return {};
+  }
+
+  std::size_t sent_bytes{0};
+};
+
+// Stands in for bitsery's OutputBufferAdapter, which only grows the buffer it writes to.
+std::span<const std::uint8_t> WritePacket(std::vector<std::uint8_t>& buffer, std::uint8_t packet_type, std::size_t size) {
+  if (buffer.size() < size) {
+    buffer.resize(size);
+  }
+  buffer[0] = packet_type;
+  for (std::size_t i = 1; i < size; ++i) {
+    buffer[i] = static_cast<std::uint8_t>(i);
+  }
+  return std::span<const std::uint8_t>(buffer.data(), size);
+}
+
+class SendPathAllocationTest : public ::testing::Test {
+protected:
+  static constexpr ConnectionHandle kConnectionCount = 16;
+
+  // One loop of the server: replication on the worker pool, a chat broadcast and an event
+  // staged for coalescing, and a direct reply.
+  void RunTick(std::uint64_t tick) {
+    auto replicate = [&](std::size_t worker_index) {
+      SendBuffer buffer;
+      for (ConnectionHandle connection = worker_index; connection < kConnectionCount; connection += pool_.GetWorkerCount()) {
+        queues_[worker_index].Push(connection, WritePacket(buffer.Get(), PT_PLAYER_SNAPSHOT, 200 + tick % 50));
+      }
+    };
+    pool_.RunOnAll(std::ref(replicate));
+    for (auto& queue : queues_) {
+      queue.Drain([&](ConnectionHandle connection, std::span<const std::uint8_t> payload) {
+        server_.Send(payload, IMMEDIATE_PRIORITY, UNRELIABLE, 0, connection);
+      });
+    }
+
+    {
+      SendBuffer buffer;
+      const auto chat = WritePacket(buffer.Get(), PT_MSG, 40 + tick % 20);
+      SendBuffer nested;
+      const auto event = WritePacket(nested.Get(), PT_DROPITEM, 24);
+      for (ConnectionHandle connection = 0; connection < kConnectionCount; ++connection) {
+        batcher_.Stage(connection, LOW_PRIORITY, RELIABLE_ORDERED, 0, chat);
+        batcher_.Stage(connection, HIGH_PRIORITY, RELIABLE, 0, event);
+      }
+    }
+    {
+      SendBuffer buffer;
+      server_.Send(WritePacket(buffer.Get(), PT_GAME_INFO, 16), MEDIUM_PRIORITY, RELIABLE, 9, tick % kConnectionCount);
+    }
+
+    batcher_.Flush([&](ConnectionHandle connection, PacketPriority priority, PacketReliability reliability, std::uint32_t channel,
+                       std::span<const std::uint8_t> payload) { server_.Send(payload, priority, reliability, channel, connection); });
+  }
+
+  WorkerPool pool_{2};
+  std::vector<OutboundQueue> queues_{2};
+  OutboundBatcher batcher_;
+  CountingNetServer server_;
+};
+
+}  // namespace
+
+TEST(SendBufferTest, ReusesBuffersOfTheSameThread) {
+  const std::uint8_t* first_data = nullptr;
+  {
+    SendBuffer buffer;
+    buffer.Get().resize(128);
+    first_data = buffer.Get().data();
+  }
+  EXPECT_GE(SendBuffer::GetPooledCount(), 1u);
+
+  SendBuffer buffer;
+  EXPECT_EQ(buffer.Get().data(), first_data);
+  EXPECT_EQ(buffer.Get().size(), 128u);
+}
+
+TEST(SendBufferTest, NestedBuffersAreDistinct) {
+  SendBuffer outer;
+  outer.Get().resize(16);
+  SendBuffer inner;
+  inner.Get().resize(16);
+  EXPECT_NE(outer.Get().data(), inner.Get().data());
+}
+
+TEST(SendBufferTest, HugeBuffersAreNotPooled) {
+  // Borrows every idle buffer, so the buffers below are new and whatever is pooled afterwards was returned by them.
+  std::vector<std::unique_ptr<SendBuffer>> borrowed;
+  while (SendBuffer::GetPooledCount() > 0) {
+    borrowed.push_back(std::make_unique<SendBuffer>());
+  }
+
+  {
+    SendBuffer buffer;
+    buffer.Get().resize(1024 * 1024);
+  }
+  EXPECT_EQ(SendBuffer::GetPooledCount(), 0u);
+
+  {
+    SendBuffer buffer;
+    buffer.Get().resize(1024);
+  }
+  EXPECT_EQ(SendBuffer::GetPooledCount(), 1u);
+}
+
+TEST_F(SendPathAllocationTest, SteadyStateTicksDoNotAllocate) {
+  // Growing the buffers, queues and maps to their working size is allowed to allocate.
+  for (std::uint64_t tick = 0; tick < 100; ++tick) {
+    RunTick(tick);
+  }
+
+  const std::size_t allocations_before = g_allocation_count.load();
+  for (std::uint64_t tick = 0; tick < 100; ++tick) {
+    RunTick(tick);
+  }
+  EXPECT_EQ(g_allocation_count.load() - allocations_before, 0u);
+  EXPECT_GT(server_.sent_bytes, 0u);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "snapshot_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace {
+
+constexpr std::uint8_t kPacketType = 0xAB;
+
+struct Collector {
+  std::vector<std::vector<std::uint8_t>> packets;
+
+  void operator()(std::span<const std::uint8_t> payload) {
+    packets.emplace_back(payload.begin(), payload.end());
+  }
+};
+
+std::uint16_t EntryCount(const std::vector<std::uint8_t>& packet) {
+  return static_cast<std::uint16_t>(packet[1] | (packet[2] << 8));
+}
+
+}  // namespace
+
+TEST(SnapshotWriterTest, EmptySnapshotIsNotFlushed) {
+  SnapshotWriter writer(kPacketType);
+  Collector collector;
+
+  writer.Finish(collector);
+
+  EXPECT_TRUE(collector.packets.empty());
+}
+
+TEST(SnapshotWriterTest, WritesHeaderAndEntries) {
+  SnapshotWriter writer(kPacketType);
+  Collector collector;
+  const std::vector<std::uint8_t> first{1, 2, 3};
+  const std::vector<std::uint8_t> second{4, 5};
+
+  writer.Append(first, collector);
+  writer.Append(second, collector);
+  writer.Finish(collector);
+
+  ASSERT_EQ(collector.packets.size(), 1u);
+  const std::vector<std::uint8_t> expected{kPacketType, 2, 0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(collector.packets[0], expected);
+  EXPECT_EQ(writer.GetPendingEntryCount(), 0);
+}
+
+TEST(SnapshotWriterTest, SplitsAtMaxPacketSize) {
+  SnapshotWriter writer(kPacketType, SnapshotWriter::kHeaderSize + 10);
+  Collector collector;
+  const std::vector<std::uint8_t> entry(4, 0x11);
+
+  for (int i = 0; i < 5; ++i) {
+    writer.Append(entry, collector);
+  }
+  writer.Finish(collector);
+
+  ASSERT_EQ(collector.packets.size(), 3u);
+  EXPECT_EQ(EntryCount(collector.packets[0]), 2);
+  EXPECT_EQ(EntryCount(collector.packets[1]), 2);
+  EXPECT_EQ(EntryCount(collector.packets[2]), 1);
+  for (const auto& packet : collector.packets) {
+    EXPECT_EQ(packet[0], kPacketType);
+    EXPECT_LE(packet.size(), SnapshotWriter::kHeaderSize + 10);
+  }
+}
+
+TEST(SnapshotWriterTest, OversizedEntryGetsItsOwnPacket) {
+  SnapshotWriter writer(kPacketType, 8);
+  Collector collector;
+  const std::vector<std::uint8_t> small(2, 0x22);
+  const std::vector<std::uint8_t> large(20, 0x33);
+
+  writer.Append(small, collector);
+  writer.Append(large, collector);
+  writer.Append(small, collector);
+  writer.Finish(collector);
+
+  ASSERT_EQ(collector.packets.size(), 3u);
+  EXPECT_EQ(collector.packets[1].size(), SnapshotWriter::kHeaderSize + large.size());
+  EXPECT_EQ(EntryCount(collector.packets[1]), 1);
+}
+
+TEST(SnapshotWriterTest, EncodesEntryCountLittleEndian) {
+  SnapshotWriter writer(kPacketType, 4096);
+  Collector collector;
+  const std::vector<std::uint8_t> entry{0x44};
+
+  for (int i = 0; i < 300; ++i) {
+    writer.Append(entry, collector);
+  }
+  writer.Finish(collector);
+
+  ASSERT_EQ(collector.packets.size(), 1u);
+  EXPECT_EQ(collector.packets[0][1], 300 & 0xFF);
+  EXPECT_EQ(collector.packets[0][2], 300 >> 8);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "spatial_grid.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+constexpr float kCellSize = 1000.0f;
+
+std::vector<SpatialGrid::PlayerId> CollectInRange(const SpatialGrid& grid, const SpatialGrid::Cell& center, std::int32_t ring) {
+  std::vector<SpatialGrid::PlayerId> result;
+  grid.ForEachInRange(center, ring, [&](SpatialGrid::PlayerId player_id, const SpatialGrid::Cell&) { result.push_back(player_id); });
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+TEST(SpatialGridTest, MapsPositionsOntoHorizontalCells) {
+  SpatialGrid grid(kCellSize);
+
+  auto cell = grid.CellFor(glm::vec3(1500.0f, 99999.0f, -1.0f));
+  EXPECT_EQ(1, cell.x);
+  EXPECT_EQ(-1, cell.z);
+
+  cell = grid.CellFor(glm::vec3(-0.5f, 0.0f, 999.0f));
+  EXPECT_EQ(-1, cell.x);
+  EXPECT_EQ(0, cell.z);
+}
+
+TEST(SpatialGridTest, RingCoversRadius) {
+  SpatialGrid grid(kCellSize);
+
+  EXPECT_EQ(0, grid.RingForRadius(0.0f));
+  EXPECT_EQ(1, grid.RingForRadius(kCellSize));
+  EXPECT_EQ(2, grid.RingForRadius(kCellSize + 1.0f));
+}
+
+TEST(SpatialGridTest, QueriesOnlyNearbyCells) {
+  SpatialGrid grid(kCellSize);
+  grid.Update(1, glm::vec3(100.0f, 0.0f, 100.0f));
+  grid.Update(2, glm::vec3(1100.0f, 0.0f, -900.0f));
+  grid.Update(3, glm::vec3(5000.0f, 0.0f, 5000.0f));
+
+  auto center = grid.CellFor(glm::vec3(0.0f));
+  EXPECT_EQ((std::vector<SpatialGrid::PlayerId>{1}), CollectInRange(grid, center, 0));
+  EXPECT_EQ((std::vector<SpatialGrid::PlayerId>{1, 2}), CollectInRange(grid, center, 1));
+  EXPECT_EQ((std::vector<SpatialGrid::PlayerId>{1, 2, 3}), CollectInRange(grid, center, 5));
+}
+
+TEST(SpatialGridTest, MovesPlayerBetweenCells) {
+  SpatialGrid grid(kCellSize);
+  grid.Update(7, glm::vec3(10.0f, 0.0f, 10.0f));
+  grid.Update(7, glm::vec3(20.0f, 0.0f, 20.0f));
+  EXPECT_EQ(1u, grid.GetPlayerCount());
+
+  grid.Update(7, glm::vec3(3500.0f, 0.0f, 10.0f));
+  ASSERT_TRUE(grid.GetCell(7).has_value());
+  EXPECT_EQ(3, grid.GetCell(7)->x);
+
+  EXPECT_TRUE(CollectInRange(grid, SpatialGrid::Cell{0, 0}, 0).empty());
+  EXPECT_EQ((std::vector<SpatialGrid::PlayerId>{7}), CollectInRange(grid, SpatialGrid::Cell{3, 0}, 0));
+}
+
+TEST(SpatialGridTest, RemovesPlayer) {
+  SpatialGrid grid(kCellSize);
+  grid.Update(1, glm::vec3(0.0f));
+  grid.Update(2, glm::vec3(0.0f));
+
+  EXPECT_TRUE(grid.Remove(1));
+  EXPECT_FALSE(grid.Remove(1));
+  EXPECT_FALSE(grid.GetCell(1).has_value());
+  EXPECT_EQ((std::vector<SpatialGrid::PlayerId>{2}), CollectInRange(grid, SpatialGrid::Cell{0, 0}, 0));
+}
+
+TEST(SpatialGridTest, MeasuresChebyshevCellDistance) {
+  EXPECT_EQ(0, SpatialGrid::CellDistance({1, 1}, {1, 1}));
+  EXPECT_EQ(3, SpatialGrid::CellDistance({-1, 0}, {2, 1}));
+  EXPECT_EQ(4, SpatialGrid::CellDistance({0, -4}, {1, 0}));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,101 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "state_change_tracker.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr std::uint32_t kKeepAlive = 50;
+
+StateChangeTracker MakeTracker() {
+  StateChangeTracker::Settings settings;
+  settings.position_epsilon = 10.0f;
+  settings.keep_alive_ticks = kKeepAlive;
+  return StateChangeTracker(settings);
+}
+
+PlayerState MakeState(float x, std::int16_t animation) {
+  PlayerState state;
+  state.position = glm::vec3(x, 0.0f, 0.0f);
+  state.animation = animation;
+  return state;
+}
+
+}  // namespace
+
+TEST(StateChangeTrackerTest, IdlePlayerKeepsItsRevision) {
+  auto tracker = MakeTracker();
+  const auto first = tracker.Update(1, MakeState(0.0f, 1), 1);
+  EXPECT_NE(first, 0u);
+
+  for (std::uint64_t tick = 2; tick < kKeepAlive; ++tick) {
+    EXPECT_EQ(tracker.Update(1, MakeState(0.0f, 1), tick), first);
+  }
+  EXPECT_EQ(tracker.GetDirtyFields(1), 0);
+}
+
+TEST(StateChangeTrackerTest, SmallDriftIsSuppressedUntilItAddsUp) {
+  auto tracker = MakeTracker();
+  const auto first = tracker.Update(1, MakeState(0.0f, 1), 1);
+
+  EXPECT_EQ(tracker.Update(1, MakeState(4.0f, 1), 2), first);
+  EXPECT_EQ(tracker.GetDirtyFields(1), kPlayerStatePosition);
+  EXPECT_EQ(tracker.Update(1, MakeState(8.0f, 1), 3), first);
+  // Drift is measured from the published position, not from the previous tick.
+  EXPECT_EQ(tracker.Update(1, MakeState(12.0f, 1), 4), first + 1);
+  EXPECT_EQ(tracker.Update(1, MakeState(16.0f, 1), 5), first + 1);
+}
+
+TEST(StateChangeTrackerTest, OtherFieldsPublishImmediately) {
+  auto tracker = MakeTracker();
+  const auto first = tracker.Update(1, MakeState(0.0f, 1), 1);
+
+  EXPECT_EQ(tracker.Update(1, MakeState(0.0f, 2), 2), first + 1);
+  EXPECT_EQ(tracker.GetDirtyFields(1), kPlayerStateAnimation);
+}
+
+TEST(StateChangeTrackerTest, KeepAliveRepublishesIdlePlayers) {
+  auto tracker = MakeTracker();
+  const auto first = tracker.Update(1, MakeState(0.0f, 1), 1);
+
+  EXPECT_EQ(tracker.Update(1, MakeState(0.0f, 1), kKeepAlive), first);
+  EXPECT_EQ(tracker.Update(1, MakeState(0.0f, 1), kKeepAlive + 1), first + 1);
+}
+
+TEST(StateChangeTrackerTest, RemovedPlayerStartsOver) {
+  auto tracker = MakeTracker();
+  tracker.Update(1, MakeState(0.0f, 1), 1);
+  tracker.Update(1, MakeState(0.0f, 2), 2);
+
+  tracker.RemovePlayer(1);
+  EXPECT_EQ(tracker.Update(1, MakeState(0.0f, 2), 3), 1u);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
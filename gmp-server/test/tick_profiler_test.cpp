@@ -0,0 +1,112 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "tick_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Reported percentiles are bucket upper bounds, within about 6% of the real value.
+void ExpectNear(LatencyHistogram::Duration actual, LatencyHistogram::Duration expected) {
+  EXPECT_GE(actual, expected);
+  EXPECT_LE(actual.count(), expected.count() + expected.count() / 16 + 1);
+}
+
+}  // namespace
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.GetCount(), 0u);
+  EXPECT_EQ(histogram.Percentile(0.5), 0ns);
+  EXPECT_EQ(histogram.Max(), 0ns);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+  LatencyHistogram histogram;
+  for (int i = 1; i <= 20; ++i) {
+    histogram.Record(std::chrono::nanoseconds(i));
+  }
+  EXPECT_EQ(histogram.Percentile(0.5), 10ns);
+  EXPECT_EQ(histogram.Percentile(1.0), 20ns);
+  EXPECT_EQ(histogram.Min(), 1ns);
+}
+
+TEST(LatencyHistogramTest, PercentilesStayWithinBucketPrecision) {
+  LatencyHistogram histogram;
+  for (int i = 1; i <= 1000; ++i) {
+    histogram.Record(std::chrono::microseconds(i));
+  }
+  ExpectNear(histogram.Percentile(0.5), 500us);
+  ExpectNear(histogram.Percentile(0.99), 990us);
+  EXPECT_EQ(histogram.Percentile(1.0), 1000us);
+  EXPECT_EQ(histogram.Max(), 1000us);
+}
+
+TEST(LatencyHistogramTest, OutlierShowsUpInMaxOnly) {
+  LatencyHistogram histogram;
+  for (int i = 0; i < 999; ++i) {
+    histogram.Record(1ms);
+  }
+  histogram.Record(2s);
+
+  ExpectNear(histogram.Percentile(0.99), 1ms);
+  EXPECT_EQ(histogram.Max(), 2s);
+}
+
+TEST(LatencyHistogramTest, HugeAndNegativeValuesAreClamped) {
+  LatencyHistogram histogram;
+  histogram.Record(std::chrono::hours(100));
+  histogram.Record(-5ns);
+  EXPECT_EQ(histogram.GetCount(), 2u);
+  EXPECT_EQ(histogram.Percentile(0.5), 0ns);
+  EXPECT_GT(histogram.Percentile(1.0), std::chrono::minutes(15));
+}
+
+TEST(TickProfilerTest, PhasesAreRecordedSeparately) {
+  TickProfiler profiler;
+  profiler.Record(TickProfiler::Phase::kPulse, 1ms);
+  profiler.Record(TickProfiler::Phase::kPulse, 3ms);
+  {
+    TickProfiler::Scope scope(profiler, TickProfiler::Phase::kReplication);
+  }
+
+  EXPECT_EQ(profiler.GetHistogram(TickProfiler::Phase::kPulse).GetCount(), 2u);
+  EXPECT_EQ(profiler.GetHistogram(TickProfiler::Phase::kPulse).Max(), 3ms);
+  EXPECT_EQ(profiler.GetHistogram(TickProfiler::Phase::kReplication).GetCount(), 1u);
+  EXPECT_EQ(profiler.GetHistogram(TickProfiler::Phase::kTimers).GetCount(), 0u);
+
+  profiler.Reset();
+  EXPECT_EQ(profiler.GetHistogram(TickProfiler::Phase::kPulse).GetCount(), 0u);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,123 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "tick_rate_controller.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace {
+
+using namespace std::chrono_literals;
+using Sample = TickRateController::Sample;
+
+TickRateController::Settings MakeSettings() {
+  TickRateController::Settings settings;
+  settings.min_period = 33ms;
+  settings.max_period = 100ms;
+  settings.target_utilization = 0.5;
+  settings.full_load_players = 100;
+  settings.max_outbound_bytes_per_second = 0;
+  return settings;
+}
+
+TickRateController::Duration Settle(TickRateController& controller, const Sample& sample) {
+  for (int i = 0; i < 200; ++i) {
+    controller.Update(sample);
+  }
+  return controller.GetPeriod();
+}
+
+}  // namespace
+
+TEST(TickRateControllerTest, SpeedsUpWhenTheServerIsQuiet) {
+  TickRateController controller(MakeSettings());
+  EXPECT_EQ(controller.GetPeriod(), 100ms);
+
+  EXPECT_EQ(Settle(controller, Sample{1ms, 0, 0}), 33ms);
+  EXPECT_NEAR(controller.GetRate(), 1000.0 / 33.0, 0.01);
+}
+
+TEST(TickRateControllerTest, ShrinksGraduallyButGrowsAtOnce) {
+  TickRateController controller(MakeSettings());
+
+  const auto first = controller.Update(Sample{1ms, 0, 0});
+  EXPECT_EQ(first, 90ms);
+
+  // 40ms of work needs an 80ms period at 50% utilization, the first sample is taken as is.
+  controller.Reset(33ms);
+  EXPECT_EQ(controller.Update(Sample{40ms, 0, 0}), 80ms);
+}
+
+TEST(TickRateControllerTest, SlowsDownAsTicksGetExpensive) {
+  TickRateController controller(MakeSettings());
+  EXPECT_EQ(Settle(controller, Sample{30ms, 0, 0}), 60ms);
+  EXPECT_EQ(Settle(controller, Sample{200ms, 0, 0}), 100ms);
+}
+
+TEST(TickRateControllerTest, SlowsDownWithPlayerDensity) {
+  TickRateController controller(MakeSettings());
+
+  const auto half_load = Settle(controller, Sample{0ms, 50, 0});
+  EXPECT_GT(half_load, 65ms);
+  EXPECT_LT(half_load, 68ms);
+  EXPECT_EQ(Settle(controller, Sample{0ms, 500, 0}), 100ms);
+}
+
+TEST(TickRateControllerTest, KeepsOutboundBandwidthBelowTheLimit) {
+  auto settings = MakeSettings();
+  settings.max_outbound_bytes_per_second = 100'000;
+  TickRateController controller(settings);
+
+  // 5000 bytes per tick at 100 kB/s allows 20 ticks per second.
+  EXPECT_EQ(Settle(controller, Sample{0ms, 0, 5000}), 50ms);
+}
+
+TEST(TickRateControllerTest, EqualBoundsGiveAFixedRate) {
+  auto settings = MakeSettings();
+  settings.min_period = 50ms;
+  settings.max_period = 50ms;
+  TickRateController controller(settings);
+
+  EXPECT_FALSE(controller.IsAdaptive());
+  EXPECT_EQ(controller.Update(Sample{500ms, 1000, 1'000'000}), 50ms);
+  EXPECT_EQ(Settle(controller, Sample{0ms, 0, 0}), 50ms);
+}
+
+TEST(TickRateControllerTest, InvalidBoundsAreFixed) {
+  auto settings = MakeSettings();
+  settings.min_period = 100ms;
+  settings.max_period = 20ms;
+  TickRateController controller(settings);
+
+  EXPECT_FALSE(controller.IsAdaptive());
+  EXPECT_EQ(controller.GetPeriod(), 100ms);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
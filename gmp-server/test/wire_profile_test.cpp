@@ -0,0 +1,297 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "packets.h"
+
+namespace {
+
+using Buffer = std::vector<std::uint8_t>;
+using OutputAdapter = bitsery::OutputBufferAdapter<Buffer>;
+using InputAdapter = bitsery::InputBufferAdapter<Buffer>;
+
+template <typename Packet>
+Packet RoundTrip(const Packet& packet, std::size_t* written_size = nullptr) {
+  Buffer buffer;
+  auto size = bitsery::quickSerialization<OutputAdapter>(buffer, packet);
+  if (written_size) {
+    *written_size = size;
+  }
+
+  Packet result;
+  auto state = bitsery::quickDeserialization<InputAdapter>({buffer.begin(), size}, result);
+  EXPECT_EQ(state.first, bitsery::ReaderError::NoError);
+  EXPECT_TRUE(state.second);
+  return result;
+}
+
+PlayerState MakeState() {
+  PlayerState state;
+  state.position = glm::vec3(-12345.67f, 890.12f, 45678.9f);
+  state.nrot = glm::normalize(glm::vec3(0.6f, -0.1f, -0.8f));
+  state.left_hand_item_instance = 101;
+  state.right_hand_item_instance = -3;
+  state.equipped_armor_instance = 7001;
+  state.animation = 42;
+  state.health_points = 350;
+  state.mana_points = 25;
+  state.weapon_mode = 5;
+  state.active_spell_nr = 64;
+  state.head_direction = 3;
+  state.melee_weapon_instance = 900;
+  state.ranged_weapon_instance = 901;
+  return state;
+}
+
+void ExpectNear(const glm::vec3& actual, const glm::vec3& expected, float tolerance) {
+  EXPECT_NEAR(actual.x, expected.x, tolerance);
+  EXPECT_NEAR(actual.y, expected.y, tolerance);
+  EXPECT_NEAR(actual.z, expected.z, tolerance);
+}
+
+// Entries as ReplicatePlayerStates encodes them: the keyframe keeps the tick it was taken on.
+PlayerSnapshotEntry MakeKeyframeEntry(std::uint32_t tick, std::uint8_t sequence, const PlayerState& state) {
+  PlayerSnapshotEntry entry;
+  entry.player_id = 5;
+  entry.kind = SnapshotEntryKind::kFullState;
+  entry.tick = tick;
+  entry.baseline_sequence = sequence;
+  entry.state = state;
+  return entry;
+}
+
+PlayerSnapshotEntry MakeDeltaEntry(std::uint32_t tick, std::uint8_t sequence, const PlayerState& baseline, const PlayerState& current) {
+  PlayerSnapshotEntry entry;
+  entry.player_id = 5;
+  entry.kind = SnapshotEntryKind::kDelta;
+  entry.tick = tick;
+  entry.baseline_sequence = sequence;
+  entry.delta = MakePlayerStateDelta(baseline, current);
+  return entry;
+}
+
+// Sends the entries through the wire as one snapshot and feeds them to `remote` in order.
+std::vector<RemoteSnapshotState::Result> Receive(RemoteSnapshotState& remote, std::vector<PlayerSnapshotEntry> entries) {
+  PlayerSnapshotPacket packet;
+  packet.packet_type = 1;
+  packet.entries = std::move(entries);
+
+  std::vector<RemoteSnapshotState::Result> results;
+  for (const auto& entry : RoundTrip(packet).entries) {
+    results.push_back(remote.Accept(entry));
+  }
+  return results;
+}
+
+}  // namespace
+
+TEST(WireProfileTest, HotPacketsUseCompactProfile) {
+  static_assert(kPacketWireProfile<PlayerStateUpdatePacket> == WireProfile::kCompact);
+  static_assert(kPacketWireProfile<PlayerPositionUpdatePacket> == WireProfile::kCompact);
+  static_assert(kPacketWireProfile<PlayerSnapshotPacket> == WireProfile::kCompact);
+  static_assert(kPacketWireProfile<MessagePacket> == WireProfile::kRaw);
+}
+
+TEST(WireProfileTest, PlayerStateRoundTripsWithinPrecision) {
+  PlayerStateUpdatePacket packet;
+  packet.packet_type = 1;
+  packet.state = MakeState();
+  packet.player_id = 77;
+
+  std::size_t size = 0;
+  auto result = RoundTrip(packet, &size);
+
+  ExpectNear(result.state.position, packet.state.position, wire::kPositionPrecision);
+  ExpectNear(result.state.nrot, packet.state.nrot, 0.005f);
+  EXPECT_EQ(result.state.left_hand_item_instance, packet.state.left_hand_item_instance);
+  EXPECT_EQ(result.state.right_hand_item_instance, packet.state.right_hand_item_instance);
+  EXPECT_EQ(result.state.equipped_armor_instance, packet.state.equipped_armor_instance);
+  EXPECT_EQ(result.state.animation, packet.state.animation);
+  EXPECT_EQ(result.state.health_points, packet.state.health_points);
+  EXPECT_EQ(result.state.mana_points, packet.state.mana_points);
+  EXPECT_EQ(result.state.weapon_mode, packet.state.weapon_mode);
+  EXPECT_EQ(result.state.active_spell_nr, packet.state.active_spell_nr);
+  EXPECT_EQ(result.state.head_direction, packet.state.head_direction);
+  EXPECT_EQ(result.state.melee_weapon_instance, packet.state.melee_weapon_instance);
+  EXPECT_EQ(result.state.ranged_weapon_instance, packet.state.ranged_weapon_instance);
+  EXPECT_EQ(result.player_id, packet.player_id);
+
+  // 1 type + 28 state + 5 optional id, against 49 bytes for the raw encoding.
+  EXPECT_EQ(size, 34u);
+}
+
+TEST(WireProfileTest, OutOfRangeValuesAreClamped) {
+  PlayerStateUpdatePacket packet;
+  packet.packet_type = 1;
+  packet.state = MakeState();
+  packet.state.position = glm::vec3(1.0e7f, -1.0e7f, 0.0f);
+  packet.state.weapon_mode = 200;
+  packet.state.head_direction = 9;
+
+  auto result = RoundTrip(packet);
+
+  EXPECT_NEAR(result.state.position.x, wire::kWorldExtent, wire::kPositionPrecision);
+  EXPECT_NEAR(result.state.position.y, -wire::kWorldExtent, wire::kPositionPrecision);
+  EXPECT_EQ(result.state.weapon_mode, wire::kMaxWeaponMode);
+  EXPECT_EQ(result.state.head_direction, wire::kMaxHeadDirection);
+  // The sender's packet is left untouched.
+  EXPECT_EQ(packet.state.weapon_mode, 200);
+}
+
+TEST(WireProfileTest, UnitVectorsInEveryOctant) {
+  for (int i = 0; i < 8; ++i) {
+    glm::vec3 direction((i & 1) ? -0.3f : 0.5f, (i & 2) ? -0.7f : 0.2f, (i & 4) ? -0.4f : 0.9f);
+    PlayerStateUpdatePacket packet;
+    packet.packet_type = 1;
+    packet.state.nrot = glm::normalize(direction);
+
+    auto result = RoundTrip(packet);
+    ExpectNear(result.state.nrot, packet.state.nrot, 0.005f);
+  }
+}
+
+TEST(WireProfileTest, SnapshotDeltaCarriesOnlyChangedFields) {
+  PlayerState baseline = MakeState();
+  PlayerState current = baseline;
+  current.position.x += 250.0f;
+  current.animation = 43;
+
+  PlayerSnapshotPacket packet;
+  packet.packet_type = 1;
+  PlayerSnapshotEntry entry;
+  entry.player_id = 5;
+  entry.kind = SnapshotEntryKind::kDelta;
+  entry.tick = 70000;
+  entry.baseline_sequence = 3;
+  entry.delta = MakePlayerStateDelta(baseline, current);
+  packet.entries.push_back(entry);
+
+  std::size_t size = 0;
+  auto result = RoundTrip(packet, &size);
+
+  ASSERT_EQ(result.entries.size(), 1u);
+  const auto& decoded = result.entries[0];
+  EXPECT_EQ(decoded.kind, SnapshotEntryKind::kDelta);
+  EXPECT_EQ(decoded.tick, 70000u);
+  EXPECT_EQ(decoded.baseline_sequence, 3);
+  EXPECT_EQ(decoded.delta.changed_fields, kPlayerStatePosition | kPlayerStateAnimation);
+
+  PlayerState applied = baseline;
+  ApplyPlayerStateDelta(decoded.delta, applied);
+  ExpectNear(applied.position, current.position, wire::kPositionPrecision);
+  EXPECT_EQ(applied.animation, 43);
+
+  // Header (3) + id, kind, tick, sequence (10) + mask (2) + 57 bits of position and 16 of animation.
+  EXPECT_EQ(size, 3u + 10u + 2u + 10u);
+}
+
+TEST(WireProfileTest, SnapshotTicksCompareAcrossTheWrapAround) {
+  EXPECT_TRUE(IsNewerSnapshotTick(11, 10));
+  EXPECT_FALSE(IsNewerSnapshotTick(10, 10));
+  EXPECT_FALSE(IsNewerSnapshotTick(9, 10));
+  EXPECT_TRUE(IsNewerSnapshotTick(2, 0xFFFFFFFEu));
+  EXPECT_FALSE(IsNewerSnapshotTick(0xFFFFFFFEu, 2));
+}
+
+TEST(WireProfileTest, KeyframeAndDeltaInOneSnapshotEndInTheCurrentState) {
+  using Result = RemoteSnapshotState::Result;
+  const PlayerState keyframe = MakeState();
+  PlayerState current = keyframe;
+  current.position.x += 250.0f;
+  current.animation = 43;
+
+  // A recipient seeing the player for the first time.
+  RemoteSnapshotState fresh;
+  EXPECT_EQ(Receive(fresh, {MakeKeyframeEntry(10, 1, keyframe), MakeDeltaEntry(15, 1, keyframe, current)}),
+            (std::vector<Result>{Result::kApply, Result::kApply}));
+  EXPECT_EQ(fresh.GetState().animation, 43);
+  ExpectNear(fresh.GetState().position, current.position, wire::kPositionPrecision);
+
+  // A recipient that applied a newer state than the keyframe against the previous baseline still takes
+  // the keyframe as its baseline, and the delta on top of it.
+  RemoteSnapshotState behind;
+  ASSERT_EQ(Receive(behind, {MakeKeyframeEntry(2, 0, keyframe), MakeDeltaEntry(14, 0, keyframe, keyframe)}),
+            (std::vector<Result>{Result::kApply, Result::kApply}));
+  EXPECT_EQ(Receive(behind, {MakeKeyframeEntry(10, 1, keyframe), MakeDeltaEntry(15, 1, keyframe, current)}),
+            (std::vector<Result>{Result::kStale, Result::kApply}));
+  EXPECT_EQ(behind.GetState().animation, 43);
+}
+
+TEST(WireProfileTest, ReorderedOlderSnapshotIsDropped) {
+  using Result = RemoteSnapshotState::Result;
+  const PlayerState keyframe = MakeState();
+  PlayerState older = keyframe;
+  older.animation = 50;
+  PlayerState newer = keyframe;
+  newer.animation = 51;
+
+  RemoteSnapshotState remote;
+  ASSERT_EQ(Receive(remote, {MakeKeyframeEntry(20, 1, keyframe)}), std::vector<Result>{Result::kApply});
+  ASSERT_EQ(Receive(remote, {MakeDeltaEntry(22, 1, keyframe, newer)}), std::vector<Result>{Result::kApply});
+
+  // The snapshot of tick 21 arrives after the one of tick 22.
+  EXPECT_EQ(Receive(remote, {MakeDeltaEntry(21, 1, keyframe, older)}), std::vector<Result>{Result::kStale});
+  EXPECT_EQ(remote.GetState().animation, 51);
+
+  // So does an old keyframe, which must not replace the baseline later deltas are taken against.
+  PlayerState next_keyframe = newer;
+  next_keyframe.animation = 60;
+  ASSERT_EQ(Receive(remote, {MakeKeyframeEntry(30, 2, next_keyframe)}), std::vector<Result>{Result::kApply});
+  EXPECT_EQ(Receive(remote, {MakeKeyframeEntry(20, 1, keyframe)}), std::vector<Result>{Result::kStale});
+  PlayerState current = next_keyframe;
+  current.animation = 61;
+  EXPECT_EQ(Receive(remote, {MakeDeltaEntry(31, 2, next_keyframe, current)}), std::vector<Result>{Result::kApply});
+  EXPECT_EQ(remote.GetState().animation, 61);
+
+  // A delta against a baseline that never arrived is not applied.
+  EXPECT_EQ(Receive(remote, {MakeDeltaEntry(32, 3, current, current)}), std::vector<Result>{Result::kMissingBaseline});
+}
+
+TEST(WireProfileTest, PositionOnlyEntryAfterAFullState) {
+  using Result = RemoteSnapshotState::Result;
+  RemoteSnapshotState remote;
+  ASSERT_EQ(Receive(remote, {MakeKeyframeEntry(5, 1, MakeState())}), std::vector<Result>{Result::kApply});
+
+  PlayerSnapshotEntry position_only;
+  position_only.player_id = 5;
+  position_only.kind = SnapshotEntryKind::kPositionOnly;
+  position_only.tick = 6;
+  position_only.position = glm::vec3(100.0f, 0.0f, 200.0f);
+  EXPECT_EQ(Receive(remote, {position_only}), std::vector<Result>{Result::kApply});
+  EXPECT_EQ(Receive(remote, {position_only}), std::vector<Result>{Result::kStale});
+
+  // A full state from before the position is stale for applying, the player is already further along.
+  EXPECT_EQ(Receive(remote, {MakeKeyframeEntry(5, 1, MakeState())}), std::vector<Result>{Result::kStale});
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
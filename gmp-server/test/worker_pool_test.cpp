@@ -0,0 +1,112 @@
+/*
+MIT License
+
+Copyright (c) 2025 Gothic Multiplayer Team.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "worker_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "outbound_queue.h"
+
+TEST(WorkerPoolTest, EveryWorkerRunsTheJobOnce) {
+  WorkerPool pool(4);
+  ASSERT_EQ(pool.GetWorkerCount(), 4u);
+
+  std::vector<std::atomic<int>> runs(4);
+  pool.RunOnAll([&](std::size_t worker_index) { runs[worker_index].fetch_add(1); });
+
+  for (const auto& count : runs) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+TEST(WorkerPoolTest, WorkerZeroRunsOnTheCallingThread) {
+  WorkerPool pool(3);
+  const auto caller = std::this_thread::get_id();
+
+  std::vector<std::thread::id> thread_ids(3);
+  pool.RunOnAll([&](std::size_t worker_index) { thread_ids[worker_index] = std::this_thread::get_id(); });
+
+  EXPECT_EQ(thread_ids[0], caller);
+  EXPECT_NE(thread_ids[1], caller);
+  EXPECT_NE(thread_ids[2], caller);
+  EXPECT_NE(thread_ids[1], thread_ids[2]);
+}
+
+TEST(WorkerPoolTest, ResultsAreVisibleAfterEveryRound) {
+  WorkerPool pool(4);
+  std::vector<std::uint64_t> partial(pool.GetWorkerCount());
+
+  for (std::uint64_t round = 1; round <= 1000; ++round) {
+    pool.RunOnAll([&](std::size_t worker_index) { partial[worker_index] += round; });
+  }
+
+  for (auto sum : partial) {
+    EXPECT_EQ(sum, 1000u * 1001u / 2);
+  }
+}
+
+TEST(WorkerPoolTest, SingleWorkerHasNoThreads) {
+  WorkerPool pool(0);
+  EXPECT_EQ(pool.GetWorkerCount(), 1u);
+
+  std::thread::id ran_on;
+  pool.RunOnAll([&](std::size_t) { ran_on = std::this_thread::get_id(); });
+  EXPECT_EQ(ran_on, std::this_thread::get_id());
+}
+
+TEST(WorkerPoolTest, ResolveWorkerCount) {
+  EXPECT_EQ(WorkerPool::ResolveWorkerCount(3), 3u);
+  EXPECT_GE(WorkerPool::ResolveWorkerCount(0), 1u);
+}
+
+TEST(OutboundQueueTest, DrainKeepsOrderAndEmptiesTheQueue) {
+  OutboundQueue queue;
+  const std::vector<std::uint8_t> first{1, 2, 3};
+  const std::vector<std::uint8_t> second{4};
+  queue.Push(7, first);
+  queue.Push(9, second);
+  ASSERT_EQ(queue.GetMessageCount(), 2u);
+
+  std::vector<std::pair<Net::ConnectionHandle, std::vector<std::uint8_t>>> sent;
+  queue.Drain([&](Net::ConnectionHandle connection, std::span<const std::uint8_t> payload) {
+    sent.emplace_back(connection, std::vector<std::uint8_t>(payload.begin(), payload.end()));
+  });
+
+  ASSERT_EQ(sent.size(), 2u);
+  EXPECT_EQ(sent[0].first, 7u);
+  EXPECT_EQ(sent[0].second, first);
+  EXPECT_EQ(sent[1].first, 9u);
+  EXPECT_EQ(sent[1].second, second);
+  EXPECT_EQ(queue.GetMessageCount(), 0u);
+}
+
+int main(int argc, char** argv) {
+  ::testing::GTEST_FLAG(catch_exceptions) = false;
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
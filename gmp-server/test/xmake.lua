@@ -51,4 +51,226 @@ target("ClientResourcePackagerTest")
     add_packages("gtest")
     add_tests("default")
     set_rundir(os.projectdir())
-    set_default(false)
\ No newline at end of file
+    set_default(false)
+
+target("SpatialGridTest")
+    set_kind("binary")
+    add_files("spatial_grid_test.cpp")
+    add_deps("Server")
+    add_packages("glm")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("SnapshotWriterTest")
+    set_kind("binary")
+    add_files("snapshot_writer_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("ReplicationBaselinesTest")
+    set_kind("binary")
+    add_files("replication_baselines_test.cpp")
+    add_deps("Server")
+    add_packages("glm", "fmt")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("WireProfileTest")
+    set_kind("binary")
+    add_files("wire_profile_test.cpp")
+    add_deps("Server")
+    add_packages("bitsery", "glm", "fmt")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("ReplicationLodTest")
+    set_kind("binary")
+    add_files("replication_lod_test.cpp")
+    add_deps("Server")
+    add_packages("glm")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("ReplicationSchedulerTest")
+    set_kind("binary")
+    add_files("replication_scheduler_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("FixedTimestepTest")
+    set_kind("binary")
+    add_files("fixed_timestep_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("WorkerPoolTest")
+    set_kind("binary")
+    add_files("worker_pool_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("StateChangeTrackerTest")
+    set_kind("binary")
+    add_files("state_change_tracker_test.cpp")
+    add_deps("Server")
+    add_packages("glm", "fmt")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("PlayerHistoryTest")
+    set_kind("binary")
+    add_files("player_history_test.cpp")
+    add_deps("Server")
+    add_packages("glm")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("TickProfilerTest")
+    set_kind("binary")
+    add_files("tick_profiler_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("RespawnQueueTest")
+    set_kind("binary")
+    add_files("respawn_queue_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("OutboundBatcherTest")
+    set_kind("binary")
+    add_files("outbound_batcher_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("SendPathAllocationTest")
+    set_kind("binary")
+    add_files("send_path_allocation_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("JoinSnapshotTest")
+    set_kind("binary")
+    add_files("join_snapshot_test.cpp")
+    add_deps("Server")
+    add_packages("bitsery", "glm", "fmt")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("PacketTemplateTest")
+    set_kind("binary")
+    add_files("packet_template_test.cpp")
+    add_deps("Server")
+    add_packages("bitsery", "glm", "fmt")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("TickRateControllerTest")
+    set_kind("binary")
+    add_files("tick_rate_controller_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("PlayerManagerTest")
+    set_kind("binary")
+    add_files("player_manager_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("ConnectionIndexTest")
+    set_kind("binary")
+    add_files("connection_index_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("ConnectionLookupBenchmark")
+    set_kind("binary")
+    add_files("connection_lookup_benchmark.cpp")
+    add_deps("Server")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("PlayerIndexTest")
+    set_kind("binary")
+    add_files("player_index_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("ResumableSessionsTest")
+    set_kind("binary")
+    add_files("resumable_sessions_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("NetStreamsTest")
+    set_kind("binary")
+    add_files("net_streams_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
+
+target("AreaEventsTest")
+    set_kind("binary")
+    add_files("area_events_test.cpp")
+    add_deps("Server")
+    add_packages("gtest")
+    add_tests("default")
+    set_rundir(os.projectdir())
+    set_default(false)
@@ -62,7 +62,7 @@ template <typename TContainer = std::vector<std::uint8_t>, typename Packet>
 void SerializeAndSend(NetClient* client, const Packet& packet, Net::PacketPriority priority, Net::PacketReliability reliable) {
   TContainer buffer;
   auto written_size = bitsery::quickSerialization<bitsery::OutputBufferAdapter<TContainer>>(buffer, packet);
-  client->SendPacket(buffer.data(), written_size, reliable, priority);
+  client->SendPacket(buffer.data(), written_size, reliable, priority, STREAM_SESSION);
 }
 
 }  // namespace
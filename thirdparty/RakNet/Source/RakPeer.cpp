@@ -216,6 +216,8 @@ RakPeer::RakPeer()
 	endThreads = true;
 	isMainLoopThreadActive = false;
 	incomingDatagramEventHandler=0;
+	packetReadyEventHandler=0;
+	packetReadyEventData=0;
 
 
 
@@ -2994,6 +2996,12 @@ void RakPeer::SetIncomingDatagramEventHandler( bool (*_incomingDatagramEventHand
 	incomingDatagramEventHandler=_incomingDatagramEventHandler;
 }
 // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+void RakPeer::SetPacketReadyEventHandler( void (*_packetReadyEventHandler)(void *), void *_packetReadyEventData )
+{
+	packetReadyEventData=_packetReadyEventData;
+	packetReadyEventHandler=_packetReadyEventHandler;
+}
+// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool RakPeer::SendOutOfBand(const char *host, unsigned short remotePort, const char *data, BitSize_t dataLength, unsigned connectionSocketIndex )
 {
 	if ( IsActive() == false )
@@ -4455,6 +4463,9 @@ inline void RakPeer::AddPacketToProducer(RakNet::Packet *p)
 	packetReturnMutex.Lock();
 	packetReturnQueue.Push(p,_FILE_AND_LINE_);
 	packetReturnMutex.Unlock();
+
+	if (packetReadyEventHandler)
+		packetReadyEventHandler(packetReadyEventData);
 }
 // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 union Buff6AndBuff8
@@ -583,6 +583,10 @@ public:
 	/// RNS2RecvStruct will only remain valid for the duration of the call
 	virtual void SetIncomingDatagramEventHandler( bool (*_incomingDatagramEventHandler)(RNS2RecvStruct *) );
 
+	/// Set a C callback to be called whenever a packet has been queued for Receive()
+	/// The callback is invoked from RakNet's internal threads and must not call back into RakPeer.
+	virtual void SetPacketReadyEventHandler( void (*_packetReadyEventHandler)(void *), void *_packetReadyEventData );
+
 	// --------------------------------------------------------------------------------------------Network Simulator Functions--------------------------------------------------------------------------------------------
 	/// Adds simulated ping and packet loss to the outgoing data flow.
 	/// To simulate bi-directional ping and packet loss, you should call this on both the sender and the recipient, with half the total ping and packetloss value on each.
@@ -976,6 +980,9 @@ protected:
 
 	bool (*incomingDatagramEventHandler)(RNS2RecvStruct *);
 
+	void (*packetReadyEventHandler)(void *);
+	void *packetReadyEventData;
+
 	// Systems in this list will not go through the secure connection process, even when secure connections are turned on. Wildcards are accepted.
 	DataStructures::List<RakNet::RakString> securityExceptionList;
 
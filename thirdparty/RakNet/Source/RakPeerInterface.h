@@ -547,6 +547,11 @@ public:
 	/// For RakNet connected systems, the first bit is always 1. So for your own game packets, make sure the first bit is always 0.
 	virtual void SetIncomingDatagramEventHandler( bool (*_incomingDatagramEventHandler)(RNS2RecvStruct *) )=0;
 
+	/// Set a C callback to be called whenever a packet has been queued for Receive()
+	/// Unlike the incoming datagram handler, this runs after the datagram has been processed, so Receive() will return the packet.
+	/// The callback is invoked from RakNet's internal threads and must not call back into RakPeer.
+	virtual void SetPacketReadyEventHandler( void (*_packetReadyEventHandler)(void *), void *_packetReadyEventData )=0;
+
 	// --------------------------------------------------------------------------------------------Network Simulator Functions--------------------------------------------------------------------------------------------
 	/// Adds simulated ping and packet loss to the outgoing data flow.
 	/// To simulate bi-directional ping and packet loss, you should call this on both the sender and the recipient, with half the total ping and packetloss value on each.